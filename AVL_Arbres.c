@@ -0,0 +1,305 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+/*
+ * Arbres Binaires - ABR équilibré (AVL)
+ *
+ * Ce fichier reprend l'interface de TD0 (inserer, rechercher, supprimerNoeud)
+ * mais rééquilibre l'arbre après chaque modification. Chaque nœud mémorise
+ * sa hauteur ; la condition d'équilibre est celle vérifiée par f_V2
+ * (examen 2024-2025) : les hauteurs des deux sous-arbres diffèrent d'au plus 1.
+ * La hauteur reste donc en O(log n) quel que soit l'ordre des insertions.
+ *
+ * Le main compare l'AVL à l'ABR non équilibré de TD0 sur des clés triées,
+ * triées à l'envers et aléatoires.
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// -------------------- Définition de la structure --------------------
+typedef struct Noeud {
+    int valeur;
+    int hauteur;            // hauteur du sous-arbre (0 pour une feuille)
+    struct Noeud *gauche;   // sous-arbre gauche
+    struct Noeud *droit;    // sous-arbre droit
+} Noeud;
+
+typedef Noeud *Arbre;
+
+// -------------------- Fonctions utilitaires --------------------
+int maximum(int a, int b){
+    return (a > b) ? a : b;
+}
+
+// Hauteur mémorisée dans le nœud, -1 pour l'arbre vide
+// Complexité : O(1)
+int hauteur(Arbre racine){
+    if (racine == NULL) return -1;
+    return racine->hauteur;
+}
+
+// Recalcule la hauteur d'un nœud à partir de celles de ses fils
+// Complexité : O(1)
+void majHauteur(Arbre racine){
+    racine->hauteur = 1 + maximum(hauteur(racine->gauche), hauteur(racine->droit));
+}
+
+// Différence hG - hD, comprise entre -1 et 1 dans un AVL
+// Complexité : O(1)
+int desequilibre(Arbre racine){
+    return hauteur(racine->gauche) - hauteur(racine->droit);
+}
+
+// -------------------- Création d'un nœud --------------------
+Arbre creerNoeud(int v){
+    Arbre nouveau_noeud = (Arbre)malloc(sizeof(Noeud));
+    if (nouveau_noeud == NULL){
+        perror("Erreur d'allocation dans creerNoeud");
+        exit(EXIT_FAILURE);
+    }
+    nouveau_noeud->valeur = v;
+    nouveau_noeud->hauteur = 0;
+    nouveau_noeud->gauche = NULL;
+    nouveau_noeud->droit = NULL;
+    return nouveau_noeud;
+}
+
+// -------------------- Rotations --------------------
+
+/*
+ * @brief Rotation droite : le fils gauche devient la racine
+ * @param y Racine du sous-arbre
+ * @return Arbre La nouvelle racine
+ * Complexité : O(1)
+ */
+Arbre rotationDroite(Arbre y){
+    Arbre x = y->gauche;
+    y->gauche = x->droit;
+    x->droit = y;
+    majHauteur(y);
+    majHauteur(x);
+    return x;
+}
+
+/*
+ * @brief Rotation gauche : le fils droit devient la racine
+ * @param x Racine du sous-arbre
+ * @return Arbre La nouvelle racine
+ * Complexité : O(1)
+ */
+Arbre rotationGauche(Arbre x){
+    Arbre y = x->droit;
+    x->droit = y->gauche;
+    y->gauche = x;
+    majHauteur(x);
+    majHauteur(y);
+    return y;
+}
+
+/*
+ * @brief Met à jour la hauteur du nœud puis applique la rotation
+ *        (simple ou double) qui rétablit l'équilibre
+ * @param racine Nœud dont les deux sous-arbres sont des AVL
+ * @return Arbre La racine du sous-arbre équilibré
+ * Complexité : O(1)
+ */
+Arbre equilibrer(Arbre racine){
+    majHauteur(racine);
+    int d = desequilibre(racine);
+
+    if (d > 1){
+        if (desequilibre(racine->gauche) < 0){
+            racine->gauche = rotationGauche(racine->gauche);   // cas gauche-droite
+        }
+        return rotationDroite(racine);
+    }
+    if (d < -1){
+        if (desequilibre(racine->droit) > 0){
+            racine->droit = rotationDroite(racine->droit);     // cas droite-gauche
+        }
+        return rotationGauche(racine);
+    }
+    return racine;
+}
+
+// -------------------- Opérations de l'AVL --------------------
+
+/*
+ * @brief Insère v dans l'AVL (pas de doublon)
+ * @param racine Racine de l'arbre
+ * @param v Valeur à insérer
+ * @return Arbre La nouvelle racine
+ * Complexité : O(log n)
+ */
+Arbre inserer(Arbre racine, int v){
+    if (racine == NULL) return creerNoeud(v);
+
+    if (v < racine->valeur){
+        racine->gauche = inserer(racine->gauche, v);
+    } else if (v > racine->valeur){
+        racine->droit = inserer(racine->droit, v);
+    } else {
+        return racine; // doublon : l'arbre ne change pas
+    }
+    return equilibrer(racine);
+}
+
+/*
+ * @brief Recherche v dans l'AVL
+ * @param racine Racine de l'arbre
+ * @param v Valeur cherchée
+ * @return Arbre Le nœud trouvé, NULL sinon
+ * Complexité : O(log n)
+ */
+Arbre rechercher(Arbre racine, int v){
+    while (racine != NULL && racine->valeur != v){
+        racine = (v < racine->valeur) ? racine->gauche : racine->droit;
+    }
+    return racine;
+}
+
+Arbre trouverMin(Arbre racine){
+    while (racine && racine->gauche != NULL){
+        racine = racine->gauche;
+    }
+    return racine;
+}
+
+/*
+ * @brief Supprime v de l'AVL
+ * @param racine Racine de l'arbre
+ * @param v Valeur à supprimer
+ * @return Arbre La nouvelle racine
+ * Complexité : O(log n)
+ */
+Arbre supprimerNoeud(Arbre racine, int v){
+    if (racine == NULL) return racine;
+
+    if (v < racine->valeur){
+        racine->gauche = supprimerNoeud(racine->gauche, v);
+    } else if (v > racine->valeur){
+        racine->droit = supprimerNoeud(racine->droit, v);
+    } else {
+        // Cas 1 : pas d'enfant ou un seul enfant
+        if (racine->gauche == NULL){
+            Arbre temp = racine->droit;
+            free(racine);
+            return temp;
+        } else if (racine->droit == NULL){
+            Arbre temp = racine->gauche;
+            free(racine);
+            return temp;
+        }
+        // Cas 2 : deux enfants
+        Arbre temp = trouverMin(racine->droit);
+        racine->valeur = temp->valeur;
+        racine->droit = supprimerNoeud(racine->droit, temp->valeur);
+    }
+    return equilibrer(racine);
+}
+
+void detruireArbre(Arbre racine){
+    if (racine != NULL){
+        detruireArbre(racine->gauche);
+        detruireArbre(racine->droit);
+        free(racine);
+    }
+}
+
+/*
+ * @brief Vérifie l'invariant AVL et la cohérence des hauteurs mémorisées
+ * @param racine Racine de l'arbre
+ * @param h Hauteur recalculée du sous-arbre
+ * @return true si l'arbre est un AVL correct
+ * Complexité : O(n)
+ */
+bool verifierAVL(Arbre racine, int *h){
+    if (racine == NULL){ *h = -1; return true; }
+    int hG, hD;
+    bool okG = verifierAVL(racine->gauche, &hG);
+    bool okD = verifierAVL(racine->droit, &hD);
+    *h = 1 + maximum(hG, hD);
+    return okG && okD && racine->hauteur == *h && hG - hD <= 1 && hD - hG <= 1;
+}
+
+// -------------------- ABR non équilibré de TD0 (référence) --------------------
+Arbre insererABR(Arbre racine, int v){
+    if (racine == NULL) return creerNoeud(v);
+    if (v < racine->valeur){
+        racine->gauche = insererABR(racine->gauche, v);
+    } else if (v > racine->valeur){
+        racine->droit = insererABR(racine->droit, v);
+    }
+    return racine;
+}
+
+int hauteurABR(Arbre racine){
+    if (racine == NULL) return -1;
+    return 1 + maximum(hauteurABR(racine->gauche), hauteurABR(racine->droit));
+}
+
+// -------------------- Banc d'essai --------------------
+
+/*
+ * @brief Mesure insertions puis recherches de toutes les clés
+ * @param nom Nom de la structure testée
+ * @param ins Fonction d'insertion
+ * @param hauteurArbre Fonction de calcul de la hauteur
+ * @param cles Clés à insérer
+ * @param n Nombre de clés
+ * Complexité : celle des n insertions et n recherches
+ */
+void mesurer(const char *nom, Arbre (*ins)(Arbre, int), int (*hauteurArbre)(Arbre),
+             const int *cles, int n){
+    Arbre racine = NULL;
+    clock_t debut = clock();
+    for (int i = 0; i < n; i++) racine = ins(racine, cles[i]);
+    clock_t milieu = clock();
+    int trouves = 0;
+    for (int i = 0; i < n; i++) trouves += (rechercher(racine, cles[i]) != NULL);
+    clock_t fin = clock();
+    printf("  %-4s insertion %.3f s, recherche %.3f s, hauteur %d, trouvés %d\n", nom,
+           (double)(milieu - debut) / CLOCKS_PER_SEC, (double)(fin - milieu) / CLOCKS_PER_SEC,
+           hauteurArbre(racine), trouves);
+    detruireArbre(racine);
+}
+
+// -------------------- Main pour tests --------------------
+int main(int argc, char *argv[]){
+    Arbre racine = NULL;
+    for (int v = 1; v <= 7; v++) racine = inserer(racine, v);
+    int h;
+    printf("AVL après insertion de 1..7 : racine %d, hauteur %d, valide %s\n",
+           racine->valeur, hauteur(racine), verifierAVL(racine, &h) ? "Oui" : "Non");
+    racine = supprimerNoeud(racine, 4);
+    racine = supprimerNoeud(racine, 1);
+    printf("Après suppression de 4 et 1 : racine %d, hauteur %d, valide %s\n",
+           racine->valeur, hauteur(racine), verifierAVL(racine, &h) ? "Oui" : "Non");
+    detruireArbre(racine);
+
+    // L'ABR de TD0 est quadratique sur des clés triées : n reste modéré par défaut
+    int n = (argc > 1) ? atoi(argv[1]) : 10000;
+    int *cles = (int *)malloc(n * sizeof(int));
+    if (cles == NULL){
+        perror("Erreur d'allocation des clés");
+        exit(EXIT_FAILURE);
+    }
+
+    const char *flux[] = {"triées", "triées à l'envers", "aléatoires"};
+    srand(42);
+    for (int f = 0; f < 3; f++){
+        for (int i = 0; i < n; i++){
+            if (f == 0) cles[i] = i;
+            else if (f == 1) cles[i] = n - i;
+            else cles[i] = rand();
+        }
+        printf("%d clés %s :\n", n, flux[f]);
+        mesurer("ABR", insererABR, hauteurABR, cles, n);
+        mesurer("AVL", inserer, hauteur, cles, n);
+    }
+
+    free(cles);
+    return 0;
+}
@@ -0,0 +1,267 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+/*
+ * Arbres Binaires - Analyse en un seul parcours
+ *
+ * Un rapport qui appelle CompteFVrai, CompteQueuesDeCerises, compterInternes,
+ * hauteur, EstComplet, EstABR et NombreDePetitsFilsFeuilles les uns après les
+ * autres parcourt sept fois le même arbre. AnalyserArbre calcule l'ensemble de
+ * métriques demandé par l'appelant en un seul parcours préfixe itératif :
+ * - chaque nœud est dépilé une seule fois ; sa profondeur et les bornes d'ABR
+ *   héritées de ses ancêtres voyagent avec lui sur la pile, ce qui suffit à
+ *   toutes les métriques (la hauteur est la plus grande profondeur atteinte) ;
+ * - un prédicat déjà faux (EstABR, EstComplet) n'est plus évalué ;
+ * - si seuls des prédicats sont demandés et qu'ils sont tous faux, le
+ *   parcours s'arrête.
+ * La pile est un tableau qui s'agrandit : pas de récursion, donc pas de limite
+ * de profondeur liée à la pile d'appels.
+ *
+ * Le main compare l'analyse fusionnée aux sept fonctions des examens et de TD1.
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// -------------------- Définition de la structure --------------------
+typedef struct Noeud {
+    int valeur;
+    struct Noeud *SAG; // sous-arbre gauche
+    struct Noeud *SAD; // sous-arbre droit
+} Noeud;
+
+typedef Noeud *Arbre;
+
+// -------------------- Métriques --------------------
+enum {
+    METRIQUE_FVRAI               = 1 << 0,  // CompteFVrai : feuilles valant 1
+    METRIQUE_QUEUES_DE_CERISES   = 1 << 1,  // CompteQueuesDeCerises
+    METRIQUE_INTERNES            = 1 << 2,  // compterInternes
+    METRIQUE_HAUTEUR             = 1 << 3,  // hauteur (-1 pour l'arbre vide)
+    METRIQUE_COMPLET             = 1 << 4,  // EstComplet : 0 ou 2 fils partout
+    METRIQUE_ABR                 = 1 << 5,  // EstABR
+    METRIQUE_PETITS_FILS_FEUILLES = 1 << 6, // NombreDePetitsFilsFeuilles (de la racine)
+    METRIQUES_TOUTES             = (1 << 7) - 1
+};
+
+#define METRIQUES_PREDICATS (METRIQUE_COMPLET | METRIQUE_ABR)
+
+typedef struct {
+    int fvrai;
+    int queuesDeCerises;
+    int internes;
+    int hauteur;
+    int petitsFilsFeuilles;
+    bool estComplet;
+    bool estABR;
+    size_t visites;        // nœuds dépilés
+} Analyse;
+
+// -------------------- Pile du parcours --------------------
+typedef struct {
+    Arbre noeud;
+    int profondeur;
+    long min, max;         // bornes strictes imposées par les ancêtres (EstABR)
+} Cadre;
+
+typedef struct {
+    Cadre *cadres;
+    size_t taille, capacite;
+} PileCadres;
+
+void empilerCadre(PileCadres *P, Cadre c){
+    if (P->taille == P->capacite){
+        P->capacite = (P->capacite == 0) ? 64 : 2 * P->capacite;
+        Cadre *nouveau = (Cadre *)realloc(P->cadres, P->capacite * sizeof(Cadre));
+        if (nouveau == NULL){
+            perror("Erreur d'allocation pour empilerCadre");
+            exit(EXIT_FAILURE);
+        }
+        P->cadres = nouveau;
+    }
+    P->cadres[P->taille++] = c;
+}
+
+// -------------------- Analyse --------------------
+
+static bool feuille(Arbre a){
+    return a != NULL && a->SAG == NULL && a->SAD == NULL;
+}
+
+/*
+ * @brief Calcule les métriques demandées en un seul parcours
+ * @param A Racine de l'arbre
+ * @param metriques Combinaison de METRIQUE_*
+ * @return Analyse Résultats (les champs non demandés valent 0 / true)
+ * Complexité : O(n) au pire, moins si les prédicats demandés deviennent faux
+ */
+Analyse AnalyserArbre(Arbre A, unsigned int metriques){
+    Analyse R = {0, 0, 0, -1, 0, true, true, 0};
+    if (A == NULL) return R;
+
+    bool abr = metriques & METRIQUE_ABR;
+    bool complet = metriques & METRIQUE_COMPLET;
+    bool seulement_predicats = (metriques & ~METRIQUES_PREDICATS) == 0;
+
+    PileCadres P = {NULL, 0, 0};
+    empilerCadre(&P, (Cadre){A, 0, -2147483648L, 2147483647L});
+    while (P.taille > 0){
+        Cadre c = P.cadres[--P.taille];
+        Arbre a = c.noeud;
+        Arbre G = a->SAG, D = a->SAD;
+        R.visites++;
+
+        if (G == NULL && D == NULL){
+            if ((metriques & METRIQUE_FVRAI) && a->valeur == 1) R.fvrai++;
+            if ((metriques & METRIQUE_PETITS_FILS_FEUILLES) && c.profondeur == 2) R.petitsFilsFeuilles++;
+        } else {
+            if (metriques & METRIQUE_INTERNES) R.internes++;
+            if ((metriques & METRIQUE_QUEUES_DE_CERISES) && feuille(G) && feuille(D)) R.queuesDeCerises++;
+        }
+        if ((metriques & METRIQUE_HAUTEUR) && c.profondeur > R.hauteur) R.hauteur = c.profondeur;
+        if (complet && (G == NULL) != (D == NULL)){
+            R.estComplet = false;
+            complet = false;
+        }
+        if (abr && (a->valeur <= c.min || a->valeur >= c.max)){
+            R.estABR = false;
+            abr = false;
+        }
+        if (seulement_predicats && !abr && !complet) break;   // tout est déjà connu
+
+        // Le fils gauche est empilé en dernier pour être traité en premier (ordre préfixe)
+        if (D != NULL) empilerCadre(&P, (Cadre){D, c.profondeur + 1, a->valeur, c.max});
+        if (G != NULL) empilerCadre(&P, (Cadre){G, c.profondeur + 1, c.min, a->valeur});
+    }
+    free(P.cadres);
+    return R;
+}
+
+// -------------------- Fonctions d'origine (une par parcours) --------------------
+
+int CompteFVrai(Arbre A){
+    if (A == NULL) return 0;
+    if (A->SAG == NULL && A->SAD == NULL) return A->valeur == 1;
+    return CompteFVrai(A->SAG) + CompteFVrai(A->SAD);
+}
+
+int CompteQueuesDeCerises(Arbre A){
+    if (A == NULL) return 0;
+    int estQueue = (A->SAG != NULL && A->SAD != NULL && feuille(A->SAG) && feuille(A->SAD));
+    return estQueue + CompteQueuesDeCerises(A->SAG) + CompteQueuesDeCerises(A->SAD);
+}
+
+int compterInternes(Arbre a){
+    if (a == NULL || feuille(a)) return 0;
+    return 1 + compterInternes(a->SAG) + compterInternes(a->SAD);
+}
+
+int hauteur(Arbre A){
+    if (A == NULL) return -1;
+    int hg = hauteur(A->SAG), hd = hauteur(A->SAD);
+    return (hg > hd) ? hg + 1 : hd + 1;
+}
+
+bool EstComplet(Arbre racine){
+    if (!racine) return true;
+    if ((racine->SAG == NULL) != (racine->SAD == NULL)) return false;
+    return EstComplet(racine->SAG) && EstComplet(racine->SAD);
+}
+
+bool estABR_Util(Arbre a, long min, long max){
+    if (a == NULL) return true;
+    if (a->valeur <= min || a->valeur >= max) return false;
+    return estABR_Util(a->SAG, min, a->valeur) && estABR_Util(a->SAD, a->valeur, max);
+}
+
+bool EstABR(Arbre a){
+    return estABR_Util(a, -2147483648L, 2147483647L);
+}
+
+int NombreDePetitsFilsFeuilles(Arbre A){
+    if (A == NULL) return 0;
+    int cpt = 0;
+    if (A->SAG != NULL) cpt += feuille(A->SAG->SAG) + feuille(A->SAG->SAD);
+    if (A->SAD != NULL) cpt += feuille(A->SAD->SAG) + feuille(A->SAD->SAD);
+    return cpt;
+}
+
+// -------------------- Construction d'arbres de test --------------------
+Arbre creerNoeud(int v){
+    Arbre N = (Arbre)malloc(sizeof(Noeud));
+    if (N == NULL){
+        perror("Erreur d'allocation dans creerNoeud");
+        exit(EXIT_FAILURE);
+    }
+    N->valeur = v;
+    N->SAG = N->SAD = NULL;
+    return N;
+}
+
+// Insertion itérative dans un ABR (sans doublon)
+Arbre inserer(Arbre A, int v){
+    Arbre *place = &A;
+    while (*place != NULL){
+        if (v == (*place)->valeur) return A;
+        place = (v < (*place)->valeur) ? &(*place)->SAG : &(*place)->SAD;
+    }
+    *place = creerNoeud(v);
+    return A;
+}
+
+void detruireArbre(Arbre A){
+    if (A == NULL) return;
+    detruireArbre(A->SAG);
+    detruireArbre(A->SAD);
+    free(A);
+}
+
+void afficherAnalyse(const char *nom, Analyse R){
+    printf("  %-22s FVrai %d, cerises %d, internes %d, hauteur %d, petits-fils feuilles %d, complet %s, ABR %s\n",
+           nom, R.fvrai, R.queuesDeCerises, R.internes, R.hauteur, R.petitsFilsFeuilles,
+           R.estComplet ? "oui" : "non", R.estABR ? "oui" : "non");
+}
+
+// -------------------- Main pour tester --------------------
+int main(int argc, char *argv[]){
+    // Petit arbre des examens
+    Arbre racine = creerNoeud(1);
+    racine->SAG = creerNoeud(1);
+    racine->SAD = creerNoeud(0);
+    racine->SAD->SAG = creerNoeud(1);
+    racine->SAD->SAD = creerNoeud(1);
+    printf("Petit arbre :\n");
+    afficherAnalyse("un parcours", AnalyserArbre(racine, METRIQUES_TOUTES));
+    detruireArbre(racine);
+
+    int n = (argc > 1) ? atoi(argv[1]) : 2000000;
+    Arbre A = NULL;
+    srand(7);
+    for (int i = 0; i < n; i++) A = inserer(A, rand() % (4 * n) - 2 * n);
+
+    clock_t t0 = clock();
+    Analyse separe = {CompteFVrai(A), CompteQueuesDeCerises(A), compterInternes(A), hauteur(A),
+                      NombreDePetitsFilsFeuilles(A), EstComplet(A), EstABR(A), 0};
+    clock_t t1 = clock();
+    Analyse fusion = AnalyserArbre(A, METRIQUES_TOUTES);
+    clock_t t2 = clock();
+    Analyse predicats = AnalyserArbre(A, METRIQUE_COMPLET);
+    clock_t t3 = clock();
+
+    printf("ABR aléatoire de %d clés tirées :\n", n);
+    afficherAnalyse("sept parcours", separe);
+    afficherAnalyse("un parcours", fusion);
+    bool identiques = separe.fvrai == fusion.fvrai && separe.queuesDeCerises == fusion.queuesDeCerises &&
+                      separe.internes == fusion.internes && separe.hauteur == fusion.hauteur &&
+                      separe.petitsFilsFeuilles == fusion.petitsFilsFeuilles &&
+                      separe.estComplet == fusion.estComplet && separe.estABR == fusion.estABR;
+    printf("  résultats %s ; sept parcours %.3f s, un parcours %.3f s (%zu nœuds visités)\n",
+           identiques ? "identiques" : "différents",
+           (double)(t1 - t0) / CLOCKS_PER_SEC, (double)(t2 - t1) / CLOCKS_PER_SEC, fusion.visites);
+    printf("  EstComplet seul : %s après %zu nœuds visités (%.6f s)\n",
+           predicats.estComplet ? "oui" : "non", predicats.visites, (double)(t3 - t2) / CLOCKS_PER_SEC);
+
+    detruireArbre(A);
+    return 0;
+}
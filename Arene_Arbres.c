@@ -0,0 +1,418 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+/*
+ * Arbres Binaires - Allocation des nœuds dans une arène
+ *
+ * Ce fichier reprend les opérations de TD0 (création, insertion,
+ * suppression, destruction) mais les nœuds ne sont plus alloués un par un
+ * avec malloc : ils proviennent d'une arène.
+ * - Les nœuds sont rangés côte à côte dans de grandes tranches contiguës
+ *   (meilleure localité lors des parcours).
+ * - Les nœuds supprimés (supprimerNoeud, SIMPLIFIE) sont placés dans une
+ *   liste de nœuds libres et réutilisés par les allocations suivantes.
+ * - La destruction d'un arbre entier se fait en O(1) en réinitialisant l'arène.
+ * - Un arbre équilibré peut être construit en O(n) à partir de valeurs triées,
+ *   dans un bloc contigu de nœuds rangés en ordre préfixe.
+ *
+ * L'arène elle-même est définie dans Arene_Arbres.h, partagée avec TD1
+ * (creerNoeudAvecFils_Arene) et les examens (SIMPLIFIE_Arene, RPQDCPP_Arene) ;
+ * les nœuds ont la même forme (SAG, SAD) que dans ces fichiers.
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// -------------------- Définition de la structure --------------------
+typedef struct Noeud {
+    int valeur;
+    struct Noeud *SAG; // sous-arbre gauche
+    struct Noeud *SAD; // sous-arbre droit
+} Noeud;
+
+typedef Noeud *Arbre; // Arbre désigne la racine
+
+#include "Arene_Arbres.h"   // après Noeud : l'arène en dépend
+
+// -------------------- Création de nœuds --------------------
+
+/*
+ * @brief Crée un nœud avec ses sous-arbres dans l'arène
+ * @param A L'arène
+ * @param G Sous-arbre gauche
+ * @param D Sous-arbre droit
+ * @param v Valeur du nœud
+ * @return Arbre Nouveau nœud
+ * Complexité : O(1) amorti
+ */
+Arbre creerNoeudAvecFils(Arene *A, Arbre G, Arbre D, int v){
+    Arbre N = allouerNoeud(A);
+    N->valeur = v;
+    N->SAG = G;
+    N->SAD = D;
+    return N;
+}
+
+/*
+ * @brief Crée une feuille dans l'arène
+ * @param A L'arène
+ * @param v Valeur du nœud
+ * @return Arbre Nouveau nœud feuille
+ * Complexité : O(1) amorti
+ */
+Arbre creerNoeud(Arene *A, int v){
+    return creerNoeudAvecFils(A, NULL, NULL, v);
+}
+
+// -------------------- Opérations d'ABR --------------------
+
+/*
+ * @brief Insère v dans l'ABR (pas de doublon)
+ * @param A L'arène qui fournit le nouveau nœud
+ * @param racine Racine de l'arbre
+ * @param v Valeur à insérer
+ * @return Arbre La racine
+ * Complexité : O(h) où h = hauteur de l'arbre
+ */
+Arbre inserer(Arene *A, Arbre racine, int v){
+    if (racine == NULL) return creerNoeud(A, v);
+
+    if (v < racine->valeur){
+        racine->SAG = inserer(A, racine->SAG, v);
+    } else if (v > racine->valeur){
+        racine->SAD = inserer(A, racine->SAD, v);
+    }
+    return racine;
+}
+
+/*
+ * @brief Recherche v dans l'ABR
+ * @param racine Racine de l'arbre
+ * @param v Valeur cherchée
+ * @return Arbre Le nœud trouvé, NULL sinon
+ * Complexité : O(h)
+ */
+Arbre rechercher(Arbre racine, int v){
+    while (racine != NULL && racine->valeur != v){
+        racine = (v < racine->valeur) ? racine->SAG : racine->SAD;
+    }
+    return racine;
+}
+
+Arbre trouverMin(Arbre racine){
+    while (racine && racine->SAG != NULL){
+        racine = racine->SAG;
+    }
+    return racine;
+}
+
+/*
+ * @brief Supprime v de l'ABR, le nœud retiré est recyclé dans l'arène
+ * @param A L'arène
+ * @param racine Racine de l'arbre
+ * @param v Valeur à supprimer
+ * @return Arbre La nouvelle racine
+ * Complexité : O(h)
+ */
+Arbre supprimerNoeud(Arene *A, Arbre racine, int v){
+    if (racine == NULL) return racine;
+
+    if (v < racine->valeur){
+        racine->SAG = supprimerNoeud(A, racine->SAG, v);
+    } else if (v > racine->valeur){
+        racine->SAD = supprimerNoeud(A, racine->SAD, v);
+    } else {
+        // Cas 1 : pas d'enfant ou un seul enfant
+        if (racine->SAG == NULL){
+            Arbre temp = racine->SAD;
+            recyclerNoeud(A, racine);
+            return temp;
+        } else if (racine->SAD == NULL){
+            Arbre temp = racine->SAG;
+            recyclerNoeud(A, racine);
+            return temp;
+        }
+        // Cas 2 : deux enfants
+        Arbre temp = trouverMin(racine->SAD);
+        racine->valeur = temp->valeur;
+        racine->SAD = supprimerNoeud(A, racine->SAD, temp->valeur);
+    }
+    return racine;
+}
+
+/*
+ * @brief Rend à l'arène tous les nœuds d'un sous-arbre
+ *        (pour détruire tout l'arbre, reinitialiserArene suffit)
+ * @param A L'arène
+ * @param racine Racine du sous-arbre
+ * Complexité : O(n)
+ */
+void detruireArbre(Arene *A, Arbre racine){
+    if (racine != NULL){
+        detruireArbre(A, racine->SAG);
+        detruireArbre(A, racine->SAD);
+        recyclerNoeud(A, racine);
+    }
+}
+
+// -------------------- Construction à partir de valeurs triées --------------------
+
+// Source de valeurs triées : renvoie la valeur suivante à chaque appel
+typedef int (*LecteurTrie)(void *ctx);
+
+// Curseur sur un tableau trié, utilisé comme LecteurTrie
+typedef struct {
+    const int *valeurs;
+    size_t position;
+} CurseurTableau;
+
+int lireTableau(void *ctx){
+    CurseurTableau *C = (CurseurTableau *)ctx;
+    return C->valeurs[C->position++];
+}
+
+/*
+ * @brief Construit un arbre équilibré de n nœuds dans bloc[0..n-1] en ordre
+ *        préfixe : la racine en bloc[0], le sous-arbre gauche juste après,
+ *        puis le sous-arbre droit. Les valeurs sont lues dans l'ordre infixe.
+ * @param bloc Les n nœuds réservés
+ * @param n Taille du sous-arbre
+ * @param lire Source de valeurs triées
+ * @param ctx Contexte de la source
+ * @return Arbre La racine (bloc, ou NULL si n == 0)
+ * Complexité : O(n)
+ */
+Arbre construireRec(Noeud *bloc, size_t n, LecteurTrie lire, void *ctx){
+    if (n == 0) return NULL;
+    size_t nG = (n - 1) / 2;
+    Arbre racine = bloc;
+    racine->SAG = construireRec(bloc + 1, nG, lire, ctx);
+    racine->valeur = lire(ctx);
+    racine->SAD = construireRec(bloc + 1 + nG, n - 1 - nG, lire, ctx);
+    return racine;
+}
+
+/*
+ * @brief Construit un ABR parfaitement équilibré à partir de n valeurs
+ *        fournies dans l'ordre croissant par lire, sans les stocker
+ * @param A L'arène
+ * @param n Nombre de valeurs à lire
+ * @param lire Source de valeurs triées (strictement croissantes)
+ * @param ctx Contexte de la source
+ * @return Arbre La racine
+ * Complexité : O(n), hauteur floor(log2 n)
+ */
+Arbre construireDepuisFlux(Arene *A, size_t n, LecteurTrie lire, void *ctx){
+    return construireRec(reserverNoeuds(A, n), n, lire, ctx);
+}
+
+/*
+ * @brief Construit un ABR parfaitement équilibré à partir d'un tableau trié
+ * @param A L'arène
+ * @param trie Valeurs strictement croissantes
+ * @param n Nombre de valeurs
+ * @return Arbre La racine
+ * Complexité : O(n)
+ */
+Arbre construireDepuisTrie(Arene *A, const int *trie, size_t n){
+    CurseurTableau C = {trie, 0};
+    return construireDepuisFlux(A, n, lireTableau, &C);
+}
+
+/*
+ * @brief Parcours infixe de Morris : sans pile ni récursion, donc sans
+ *        risque de débordement sur un arbre dégénéré ; les pointeurs droits
+ *        temporaires vers le successeur sont retirés au passage et l'arbre
+ *        est rendu intact
+ * @param racine Racine de l'arbre
+ * @param sortie Tableau recevant les valeurs (NULL pour seulement compter)
+ * @return size_t Nombre de nœuds visités
+ * Complexité : O(n) en temps, O(1) en mémoire
+ */
+static size_t parcoursMorris(Arbre racine, int *sortie){
+    size_t k = 0;
+    Arbre courant = racine;
+    while (courant != NULL){
+        if (courant->SAG == NULL){
+            if (sortie != NULL) sortie[k] = courant->valeur;
+            k++;
+            courant = courant->SAD;
+            continue;
+        }
+        Arbre pred = courant->SAG;
+        while (pred->SAD != NULL && pred->SAD != courant) pred = pred->SAD;
+        if (pred->SAD == NULL){
+            // Premier passage : lien temporaire vers le successeur
+            pred->SAD = courant;
+            courant = courant->SAG;
+        } else {
+            // Second passage : le sous-arbre gauche est terminé
+            pred->SAD = NULL;
+            if (sortie != NULL) sortie[k] = courant->valeur;
+            k++;
+            courant = courant->SAD;
+        }
+    }
+    return k;
+}
+
+/*
+ * @brief Compte les nœuds de l'arbre sans récursion
+ * @param racine Racine de l'arbre
+ * @return size_t Nombre de nœuds
+ * Complexité : O(n)
+ */
+size_t compterNoeuds(Arbre racine){
+    return parcoursMorris(racine, NULL);
+}
+
+/*
+ * @brief Copie les valeurs de l'arbre dans l'ordre infixe (croissant pour un ABR)
+ * @param racine Racine de l'arbre
+ * @param sortie Tableau d'au moins compterNoeuds(racine) cases
+ * @return size_t Nombre de valeurs copiées
+ * Complexité : O(n), itératif (parcours de Morris)
+ */
+size_t aplatir(Arbre racine, int *sortie){
+    return parcoursMorris(racine, sortie);
+}
+
+/*
+ * @brief Reconstruit un ABR équilibré et contigu à partir d'un arbre déformé
+ *        (par exemple après de nombreux supprimerNoeud) ; l'arène ne doit
+ *        contenir que cet arbre car elle est réinitialisée
+ * @param A L'arène
+ * @param racine Racine de l'arbre à reconstruire
+ * @return Arbre La nouvelle racine
+ * Complexité : O(n)
+ */
+Arbre reconstruire(Arene *A, Arbre racine){
+    size_t n = compterNoeuds(racine);
+    int *trie = (int *)malloc((n + 1) * sizeof(int));
+    if (trie == NULL){
+        perror("Erreur d'allocation dans reconstruire");
+        exit(EXIT_FAILURE);
+    }
+    aplatir(racine, trie);
+    reinitialiserArene(A);
+    racine = construireDepuisTrie(A, trie, n);
+    free(trie);
+    return racine;
+}
+
+int hauteur(Arbre racine){
+    if (racine == NULL) return -1;
+    int hG = hauteur(racine->SAG);
+    int hD = hauteur(racine->SAD);
+    return 1 + ((hG > hD) ? hG : hD);
+}
+
+// -------------------- Simplification d'un arbre couleur --------------------
+
+bool estFeuille(Arbre a){
+    return a != NULL && a->SAG == NULL && a->SAD == NULL;
+}
+
+/*
+ * @brief Si deux feuilles sœurs ont la même couleur, elles sont retirées
+ *        et leur père devient une feuille de cette couleur ; les deux
+ *        feuilles sont recyclées dans l'arène
+ * @param A L'arène
+ * @param a Adresse de la racine
+ * Complexité : O(n)
+ */
+void SIMPLIFIE(Arene *A, Arbre *a){
+    if (*a == NULL || estFeuille(*a)) return;
+
+    SIMPLIFIE(A, &((*a)->SAG));
+    SIMPLIFIE(A, &((*a)->SAD));
+
+    if (estFeuille((*a)->SAG) && estFeuille((*a)->SAD)){
+        if ((*a)->SAG->valeur == (*a)->SAD->valeur){
+            int couleur = (*a)->SAG->valeur;
+            recyclerNoeud(A, (*a)->SAG);
+            recyclerNoeud(A, (*a)->SAD);
+            (*a)->SAG = NULL;
+            (*a)->SAD = NULL;
+            (*a)->valeur = couleur;
+        }
+    }
+}
+
+// -------------------- Parcours --------------------
+void visiterInfixe(Arbre racine){
+    if (racine == NULL) return;
+    visiterInfixe(racine->SAG);
+    printf("%d ", racine->valeur);
+    visiterInfixe(racine->SAD);
+}
+
+// -------------------- Exemple d'utilisation --------------------
+int main(int argc, char *argv[]){
+    Arene *A = creerArene(64);
+    Arbre racine = NULL;
+
+    int valeurs[] = {50, 30, 70, 20, 40, 60, 80};
+    for (int i = 0; i < 7; i++) racine = inserer(A, racine, valeurs[i]);
+
+    printf("Parcours infixe : ");
+    visiterInfixe(racine);
+    printf("\n");
+
+    racine = supprimerNoeud(A, racine, 70);
+    printf("Parcours infixe après suppression de 70 : ");
+    visiterInfixe(racine);
+    printf("\n");
+
+    // Le nœud libéré par la suppression est réutilisé par l'insertion suivante
+    Arbre recycle = A->libres;
+    racine = inserer(A, racine, 75);
+    printf("Nœud recyclé pour 75 : %s\n", rechercher(racine, 75) == recycle ? "Oui" : "Non");
+
+    // Arbre couleur : les deux feuilles blanches sont fusionnées
+    reinitialiserArene(A);
+    Arbre image = creerNoeudAvecFils(A, creerNoeud(A, 1), creerNoeudAvecFils(A, creerNoeud(A, 1), creerNoeud(A, 1), 0), 0);
+    SIMPLIFIE(A, &image);
+    printf("SIMPLIFIE : racine feuille = %s, couleur = %d\n", estFeuille(image) ? "Oui" : "Non", image->valeur);
+
+    // Construction et destruction d'un grand arbre
+    long n = (argc > 1) ? atol(argv[1]) : 1000000;
+    reinitialiserArene(A);
+    racine = NULL;
+    srand(42);
+    clock_t debut = clock();
+    for (long i = 0; i < n; i++) racine = inserer(A, racine, rand());
+    clock_t milieu = clock();
+    reinitialiserArene(A);
+    clock_t fin = clock();
+    printf("%ld insertions : %.3f s, destruction : %.6f s\n", n,
+           (double)(milieu - debut) / CLOCKS_PER_SEC, (double)(fin - milieu) / CLOCKS_PER_SEC);
+
+    // Construction en O(n) à partir de valeurs triées
+    reinitialiserArene(A);
+    int *trie = (int *)malloc((n + 1) * sizeof(int));
+    if (trie == NULL){
+        perror("Erreur d'allocation des valeurs triées");
+        exit(EXIT_FAILURE);
+    }
+    for (long i = 0; i < n; i++) trie[i] = 2 * (int)i;
+    debut = clock();
+    racine = construireDepuisTrie(A, trie, n);
+    fin = clock();
+    printf("Construction depuis %ld valeurs triées : %.3f s, hauteur %d\n", n,
+           (double)(fin - debut) / CLOCKS_PER_SEC, hauteur(racine));
+
+    // Après de nombreuses suppressions, l'arbre est reconstruit équilibré
+    for (long i = 0; i < n; i += 4) racine = supprimerNoeud(A, racine, 2 * (int)i);
+    racine = reconstruire(A, racine);
+    size_t restants = aplatir(racine, trie);
+    bool croissant = true;
+    for (size_t i = 1; i < restants; i++) if (trie[i - 1] >= trie[i]) croissant = false;
+    printf("Reconstruction après suppressions : %zu nœuds, hauteur %d, ordre %s\n",
+           restants, hauteur(racine), croissant ? "correct" : "incorrect");
+
+    free(trie);
+    detruireArene(A);
+    return 0;
+}
@@ -0,0 +1,193 @@
+#ifndef ARENE_ARBRES_H
+#define ARENE_ARBRES_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Arbres Binaires - Arène de nœuds partagée
+ *
+ * À inclure après la définition de Noeud (valeur, SAG, SAD) et d'Arbre,
+ * commune à TD1, aux fichiers d'examen et à Arene_Arbres.c.
+ * - Les nœuds sont découpés dans de grandes tranches contiguës
+ *   (meilleure localité lors des parcours).
+ * - Les nœuds rendus sont chaînés par SAG dans une liste de nœuds libres
+ *   et réutilisés par les allocations suivantes.
+ * - reinitialiserArene libère tous les nœuds d'un coup en O(1).
+ *
+ * nouveauNoeud et rendreNoeud acceptent une arène NULL et se comportent alors
+ * comme malloc et free : les constructeurs et SIMPLIFIE des TD et des examens
+ * prennent ainsi l'arène en option sans changer leur comportement par défaut.
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// Tranche : bloc contigu de nœuds, les tranches sont chaînées dans l'ordre d'allocation
+typedef struct Tranche {
+    struct Tranche *suivante;
+    size_t capacite;
+    Noeud noeuds[];
+} Tranche;
+
+typedef struct {
+    Tranche *premiere;   // première tranche allouée
+    Tranche *courante;   // tranche dans laquelle on découpe les nœuds
+    size_t utilises;     // nombre de nœuds déjà découpés dans la tranche courante
+    Noeud *libres;       // liste des nœuds recyclés (chaînés par le champ SAG)
+} Arene;
+
+/*
+ * @brief Alloue une nouvelle tranche de nœuds
+ * @param capacite Nombre de nœuds de la tranche
+ * @return Tranche* La tranche allouée
+ * Complexité : O(1)
+ */
+static inline Tranche *creerTranche(size_t capacite){
+    Tranche *T = (Tranche *)malloc(sizeof(Tranche) + capacite * sizeof(Noeud));
+    if (T == NULL){
+        perror("Erreur d'allocation dans creerTranche");
+        exit(EXIT_FAILURE);
+    }
+    T->suivante = NULL;
+    T->capacite = capacite;
+    return T;
+}
+
+/*
+ * @brief Crée une arène vide
+ * @param capacite_initiale Nombre de nœuds de la première tranche
+ * @return Arene* La nouvelle arène
+ * Complexité : O(1)
+ */
+static inline Arene *creerArene(size_t capacite_initiale){
+    Arene *A = (Arene *)malloc(sizeof(Arene));
+    if (A == NULL){
+        perror("Erreur d'allocation dans creerArene");
+        exit(EXIT_FAILURE);
+    }
+    if (capacite_initiale == 0) capacite_initiale = 1;
+    A->premiere = creerTranche(capacite_initiale);
+    A->courante = A->premiere;
+    A->utilises = 0;
+    A->libres = NULL;
+    return A;
+}
+
+/*
+ * @brief Fournit un nœud non initialisé : d'abord un nœud recyclé,
+ *        sinon le suivant de la tranche courante
+ * @param A L'arène
+ * @return Arbre Le nœud alloué
+ * Complexité : O(1) amorti (la taille des tranches double)
+ */
+static inline Arbre allouerNoeud(Arene *A){
+    if (A->libres != NULL){
+        Arbre N = A->libres;
+        A->libres = N->SAG;
+        return N;
+    }
+    if (A->utilises == A->courante->capacite){
+        // Tranche pleine : on réutilise la suivante si l'arène a été réinitialisée,
+        // sinon on en alloue une deux fois plus grande
+        if (A->courante->suivante == NULL){
+            A->courante->suivante = creerTranche(2 * A->courante->capacite);
+        }
+        A->courante = A->courante->suivante;
+        A->utilises = 0;
+    }
+    return &A->courante->noeuds[A->utilises++];
+}
+
+/*
+ * @brief Réserve n nœuds consécutifs dans l'arène
+ * @param A L'arène
+ * @param n Nombre de nœuds
+ * @return Noeud* Le premier des n nœuds (NULL si n == 0)
+ * Complexité : O(1) amorti
+ */
+static inline Noeud *reserverNoeuds(Arene *A, size_t n){
+    if (n == 0) return NULL;
+    if (A->courante->capacite - A->utilises < n){
+        Tranche *suivante = A->courante->suivante;
+        if (suivante == NULL || suivante->capacite < n){
+            // Nouvelle tranche insérée après la courante : les suivantes restent disponibles
+            size_t capacite = 2 * A->courante->capacite;
+            Tranche *T = creerTranche(capacite > n ? capacite : n);
+            T->suivante = suivante;
+            A->courante->suivante = T;
+            suivante = T;
+        }
+        A->courante = suivante;
+        A->utilises = 0;
+    }
+    Noeud *bloc = &A->courante->noeuds[A->utilises];
+    A->utilises += n;
+    return bloc;
+}
+
+/*
+ * @brief Rend un nœud à l'arène (il sera réutilisé par allouerNoeud)
+ * @param A L'arène
+ * @param N Le nœud à recycler
+ * Complexité : O(1)
+ */
+static inline void recyclerNoeud(Arene *A, Arbre N){
+    N->SAG = A->libres;
+    A->libres = N;
+}
+
+/*
+ * @brief Libère d'un coup tous les nœuds de l'arène ; les tranches
+ *        sont conservées pour les allocations suivantes
+ * @param A L'arène
+ * Complexité : O(1)
+ */
+static inline void reinitialiserArene(Arene *A){
+    A->courante = A->premiere;
+    A->utilises = 0;
+    A->libres = NULL;
+}
+
+/*
+ * @brief Rend toute la mémoire de l'arène au système
+ * @param A L'arène
+ * Complexité : O(k) où k = nombre de tranches, soit O(log n) grâce au doublement
+ */
+static inline void detruireArene(Arene *A){
+    Tranche *T = A->premiere;
+    while (T != NULL){
+        Tranche *suivante = T->suivante;
+        free(T);
+        T = suivante;
+    }
+    free(A);
+}
+
+/*
+ * @brief Nœud non initialisé pris dans l'arène, ou alloué par malloc
+ * @param A L'arène, NULL pour malloc
+ * @return Arbre Le nœud
+ * Complexité : O(1) amorti
+ */
+static inline Arbre nouveauNoeud(Arene *A){
+    if (A != NULL) return allouerNoeud(A);
+    Arbre N = (Arbre)malloc(sizeof(Noeud));
+    if (N == NULL){
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    return N;
+}
+
+/*
+ * @brief Rend un nœud obtenu par nouveauNoeud
+ * @param A L'arène qui l'a fourni, NULL s'il vient de malloc
+ * @param N Le nœud
+ * Complexité : O(1)
+ */
+static inline void rendreNoeud(Arene *A, Arbre N){
+    if (A != NULL) recyclerNoeud(A, N);
+    else free(N);
+}
+
+#endif
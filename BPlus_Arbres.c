@@ -0,0 +1,567 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Arbres B+ - Nœuds larges alignés sur les lignes de cache
+ *
+ * Un nœud binaire de TD0 stocke une clé de 4 octets à côté de deux pointeurs
+ * de 8 octets : l'essentiel de chaque ligne de cache lue par rechercher est
+ * perdu. Ce fichier implémente un arbre B+ dont les nœuds contiennent
+ * jusqu'à MAX_CLES clés :
+ * - les nœuds internes ne servent qu'à l'aiguillage (clés + fils),
+ * - toutes les valeurs sont dans les feuilles, chaînées de gauche à droite,
+ *   ce qui remplace le parcours infixe récursif par un simple parcours de liste.
+ *
+ * Avec MAX_CLES = 13 (valeur par défaut), une feuille occupe exactement une
+ * ligne de 64 octets et les clés d'un nœud interne tiennent dans une ligne.
+ * Pour des nœuds de L lignes, compiler avec -DMAX_CLES=(16*L - 3).
+ *
+ * Le main compare l'arbre B+ à l'ABR de TD0.
+ *
+ * La complexité temporelle de chaque fonction est indiquée (B = MAX_CLES).
+ */
+
+#ifndef MAX_CLES
+#define MAX_CLES 13
+#endif
+#define MIN_CLES ((MAX_CLES - 1) / 2)   // remplissage minimal hors racine
+#define LIGNE_CACHE 64
+
+#if MAX_CLES < 3
+#error "MAX_CLES doit valoir au moins 3"
+#endif
+
+// -------------------- Définition des structures --------------------
+typedef struct Feuille {
+    int nb;                      // nombre de clés
+    int cles[MAX_CLES];          // clés triées
+    struct Feuille *suivante;    // feuille suivante dans l'ordre croissant
+} Feuille;
+
+typedef struct Interne {
+    int nb;                      // nombre de clés (nb + 1 fils)
+    int cles[MAX_CLES];          // fils[i] contient les clés k avec cles[i-1] <= k < cles[i]
+    void *fils[MAX_CLES + 1];    // nœuds internes ou feuilles selon le niveau
+} Interne;
+
+typedef struct {
+    void *racine;                // feuille si hauteur == 0
+    int hauteur;                 // nombre de niveaux internes au-dessus des feuilles
+    size_t taille;               // nombre de clés stockées
+} ArbreBP;
+
+// -------------------- Allocation --------------------
+
+// Alloue un bloc aligné sur une ligne de cache
+// Complexité : O(1)
+void *allouerAligne(size_t octets){
+    octets = (octets + LIGNE_CACHE - 1) / LIGNE_CACHE * LIGNE_CACHE;
+    void *p = aligned_alloc(LIGNE_CACHE, octets);
+    if (p == NULL){
+        perror("Erreur d'allocation dans allouerAligne");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+Feuille *creerFeuille(void){
+    Feuille *F = (Feuille *)allouerAligne(sizeof(Feuille));
+    F->nb = 0;
+    F->suivante = NULL;
+    return F;
+}
+
+Interne *creerInterne(void){
+    Interne *I = (Interne *)allouerAligne(sizeof(Interne));
+    I->nb = 0;
+    return I;
+}
+
+/*
+ * @brief Crée un arbre B+ vide (une feuille vide comme racine)
+ * @return ArbreBP L'arbre vide
+ * Complexité : O(1)
+ */
+ArbreBP creerBP(void){
+    ArbreBP A;
+    A.racine = creerFeuille();
+    A.hauteur = 0;
+    A.taille = 0;
+    return A;
+}
+
+void detruireNoeudBP(void *noeud, int niveau){
+    if (niveau > 0){
+        Interne *I = (Interne *)noeud;
+        for (int i = 0; i <= I->nb; i++) detruireNoeudBP(I->fils[i], niveau - 1);
+    }
+    free(noeud);
+}
+
+// Complexité : O(n / B)
+void detruireBP(ArbreBP *A){
+    detruireNoeudBP(A->racine, A->hauteur);
+    A->racine = NULL;
+    A->taille = 0;
+}
+
+// -------------------- Recherche --------------------
+
+// Indice du fils à suivre : nombre de clés <= v (comptage sans branchement)
+// Complexité : O(B)
+static inline int indiceFils(const Interne *I, int v){
+    int i = 0;
+    for (int j = 0; j < I->nb; j++) i += (v >= I->cles[j]);
+    return i;
+}
+
+// Première position de la feuille dont la clé est >= v
+// Complexité : O(B)
+static inline int positionFeuille(const Feuille *F, int v){
+    int i = 0;
+    for (int j = 0; j < F->nb; j++) i += (F->cles[j] < v);
+    return i;
+}
+
+// Descend jusqu'à la feuille qui contient (ou contiendrait) v
+// Complexité : O(B log_B n)
+Feuille *trouverFeuille(const ArbreBP *A, int v){
+    void *noeud = A->racine;
+    for (int niveau = A->hauteur; niveau > 0; niveau--){
+        Interne *I = (Interne *)noeud;
+        noeud = I->fils[indiceFils(I, v)];
+    }
+    return (Feuille *)noeud;
+}
+
+/*
+ * @brief Indique si v est présent dans l'arbre
+ * @param A L'arbre B+
+ * @param v Valeur cherchée
+ * @return true si v est présent
+ * Complexité : O(B log_B n)
+ */
+bool rechercherBP(const ArbreBP *A, int v){
+    Feuille *F = trouverFeuille(A, v);
+    int i = positionFeuille(F, v);
+    return i < F->nb && F->cles[i] == v;
+}
+
+// -------------------- Insertion --------------------
+
+/*
+ * @brief Insère v sous noeud ; si noeud éclate, la moitié droite et sa
+ *        première clé sont renvoyées au père
+ * @param noeud Nœud courant
+ * @param niveau Niveau du nœud (0 pour une feuille)
+ * @param v Valeur à insérer
+ * @param cle_montee Clé séparatrice à insérer dans le père en cas d'éclatement
+ * @param nouveau Nouveau frère droit en cas d'éclatement, NULL sinon
+ * @return true si v a été inséré (false si déjà présent)
+ * Complexité : O(B log_B n)
+ */
+bool insererRec(void *noeud, int niveau, int v, int *cle_montee, void **nouveau){
+    *nouveau = NULL;
+
+    if (niveau == 0){
+        Feuille *F = (Feuille *)noeud;
+        int pos = positionFeuille(F, v);
+        if (pos < F->nb && F->cles[pos] == v) return false;
+
+        if (F->nb < MAX_CLES){
+            memmove(&F->cles[pos + 1], &F->cles[pos], (F->nb - pos) * sizeof(int));
+            F->cles[pos] = v;
+            F->nb++;
+            return true;
+        }
+
+        // Feuille pleine : MAX_CLES + 1 clés réparties sur deux feuilles
+        int tmp[MAX_CLES + 1];
+        memcpy(tmp, F->cles, pos * sizeof(int));
+        tmp[pos] = v;
+        memcpy(&tmp[pos + 1], &F->cles[pos], (F->nb - pos) * sizeof(int));
+
+        Feuille *D = creerFeuille();
+        int gauche = (MAX_CLES + 1) / 2;
+        F->nb = gauche;
+        D->nb = MAX_CLES + 1 - gauche;
+        memcpy(F->cles, tmp, gauche * sizeof(int));
+        memcpy(D->cles, &tmp[gauche], D->nb * sizeof(int));
+        D->suivante = F->suivante;
+        F->suivante = D;
+
+        *cle_montee = D->cles[0];
+        *nouveau = D;
+        return true;
+    }
+
+    Interne *I = (Interne *)noeud;
+    int i = indiceFils(I, v);
+    int cle_fils;
+    void *nouveau_fils;
+    if (!insererRec(I->fils[i], niveau - 1, v, &cle_fils, &nouveau_fils)) return false;
+    if (nouveau_fils == NULL) return true;
+
+    if (I->nb < MAX_CLES){
+        memmove(&I->cles[i + 1], &I->cles[i], (I->nb - i) * sizeof(int));
+        memmove(&I->fils[i + 2], &I->fils[i + 1], (I->nb - i) * sizeof(void *));
+        I->cles[i] = cle_fils;
+        I->fils[i + 1] = nouveau_fils;
+        I->nb++;
+        return true;
+    }
+
+    // Nœud interne plein : la clé du milieu monte dans le père
+    int tmpCles[MAX_CLES + 1];
+    void *tmpFils[MAX_CLES + 2];
+    memcpy(tmpCles, I->cles, i * sizeof(int));
+    tmpCles[i] = cle_fils;
+    memcpy(&tmpCles[i + 1], &I->cles[i], (I->nb - i) * sizeof(int));
+    memcpy(tmpFils, I->fils, (i + 1) * sizeof(void *));
+    tmpFils[i + 1] = nouveau_fils;
+    memcpy(&tmpFils[i + 2], &I->fils[i + 1], (I->nb - i) * sizeof(void *));
+
+    Interne *D = creerInterne();
+    int m = (MAX_CLES + 1) / 2;
+    I->nb = m;
+    D->nb = MAX_CLES - m;
+    memcpy(I->cles, tmpCles, m * sizeof(int));
+    memcpy(I->fils, tmpFils, (m + 1) * sizeof(void *));
+    memcpy(D->cles, &tmpCles[m + 1], D->nb * sizeof(int));
+    memcpy(D->fils, &tmpFils[m + 1], (D->nb + 1) * sizeof(void *));
+
+    *cle_montee = tmpCles[m];
+    *nouveau = D;
+    return true;
+}
+
+/*
+ * @brief Insère v dans l'arbre B+ (pas de doublon)
+ * @param A L'arbre B+
+ * @param v Valeur à insérer
+ * Complexité : O(B log_B n)
+ */
+void insererBP(ArbreBP *A, int v){
+    int cle;
+    void *nouveau;
+    if (!insererRec(A->racine, A->hauteur, v, &cle, &nouveau)) return;
+    A->taille++;
+    if (nouveau != NULL){
+        // La racine a éclaté : l'arbre gagne un niveau
+        Interne *R = creerInterne();
+        R->nb = 1;
+        R->cles[0] = cle;
+        R->fils[0] = A->racine;
+        R->fils[1] = nouveau;
+        A->racine = R;
+        A->hauteur++;
+    }
+}
+
+// -------------------- Suppression --------------------
+
+// Retire la clé i et le fils i + 1 d'un nœud interne
+// Complexité : O(B)
+void retirerDansInterne(Interne *I, int i){
+    memmove(&I->cles[i], &I->cles[i + 1], (I->nb - i - 1) * sizeof(int));
+    memmove(&I->fils[i + 1], &I->fils[i + 2], (I->nb - i - 1) * sizeof(void *));
+    I->nb--;
+}
+
+/*
+ * @brief Rétablit le remplissage minimal du fils i de P (niveau du fils
+ *        donné) par emprunt à un frère, sinon par fusion avec lui
+ * @param P Le père
+ * @param i Indice du fils en sous-effectif
+ * @param niveau Niveau du fils (0 pour une feuille)
+ * Complexité : O(B)
+ */
+void reparerFils(Interne *P, int i, int niveau){
+    if (niveau == 0){
+        Feuille *C = (Feuille *)P->fils[i];
+        Feuille *L = (i > 0) ? (Feuille *)P->fils[i - 1] : NULL;
+        Feuille *R = (i < P->nb) ? (Feuille *)P->fils[i + 1] : NULL;
+
+        if (L != NULL && L->nb > MIN_CLES){
+            memmove(&C->cles[1], &C->cles[0], C->nb * sizeof(int));
+            C->cles[0] = L->cles[--L->nb];
+            C->nb++;
+            P->cles[i - 1] = C->cles[0];
+        } else if (R != NULL && R->nb > MIN_CLES){
+            C->cles[C->nb++] = R->cles[0];
+            memmove(&R->cles[0], &R->cles[1], (--R->nb) * sizeof(int));
+            P->cles[i] = R->cles[0];
+        } else if (L != NULL){
+            memcpy(&L->cles[L->nb], C->cles, C->nb * sizeof(int));
+            L->nb += C->nb;
+            L->suivante = C->suivante;
+            free(C);
+            retirerDansInterne(P, i - 1);
+        } else {
+            memcpy(&C->cles[C->nb], R->cles, R->nb * sizeof(int));
+            C->nb += R->nb;
+            C->suivante = R->suivante;
+            free(R);
+            retirerDansInterne(P, i);
+        }
+        return;
+    }
+
+    Interne *C = (Interne *)P->fils[i];
+    Interne *L = (i > 0) ? (Interne *)P->fils[i - 1] : NULL;
+    Interne *R = (i < P->nb) ? (Interne *)P->fils[i + 1] : NULL;
+
+    if (L != NULL && L->nb > MIN_CLES){
+        // Rotation à droite à travers le séparateur du père
+        memmove(&C->cles[1], &C->cles[0], C->nb * sizeof(int));
+        memmove(&C->fils[1], &C->fils[0], (C->nb + 1) * sizeof(void *));
+        C->cles[0] = P->cles[i - 1];
+        C->fils[0] = L->fils[L->nb];
+        C->nb++;
+        P->cles[i - 1] = L->cles[--L->nb];
+    } else if (R != NULL && R->nb > MIN_CLES){
+        // Rotation à gauche à travers le séparateur du père
+        C->cles[C->nb] = P->cles[i];
+        C->fils[C->nb + 1] = R->fils[0];
+        C->nb++;
+        P->cles[i] = R->cles[0];
+        memmove(&R->cles[0], &R->cles[1], (R->nb - 1) * sizeof(int));
+        memmove(&R->fils[0], &R->fils[1], R->nb * sizeof(void *));
+        R->nb--;
+    } else {
+        // Fusion G + séparateur + D dans G
+        Interne *G = (L != NULL) ? L : C;
+        Interne *D = (L != NULL) ? C : R;
+        int sep = (L != NULL) ? i - 1 : i;
+        G->cles[G->nb] = P->cles[sep];
+        memcpy(&G->cles[G->nb + 1], D->cles, D->nb * sizeof(int));
+        memcpy(&G->fils[G->nb + 1], D->fils, (D->nb + 1) * sizeof(void *));
+        G->nb += D->nb + 1;
+        free(D);
+        retirerDansInterne(P, sep);
+    }
+}
+
+/*
+ * @brief Supprime v sous noeud
+ * @param noeud Nœud courant
+ * @param niveau Niveau du nœud (0 pour une feuille)
+ * @param v Valeur à supprimer
+ * @return true si v était présent
+ * Complexité : O(B log_B n)
+ */
+bool supprimerRec(void *noeud, int niveau, int v){
+    if (niveau == 0){
+        Feuille *F = (Feuille *)noeud;
+        int pos = positionFeuille(F, v);
+        if (pos >= F->nb || F->cles[pos] != v) return false;
+        memmove(&F->cles[pos], &F->cles[pos + 1], (F->nb - pos - 1) * sizeof(int));
+        F->nb--;
+        return true;
+    }
+
+    Interne *I = (Interne *)noeud;
+    int i = indiceFils(I, v);
+    if (!supprimerRec(I->fils[i], niveau - 1, v)) return false;
+
+    int nbFils = (niveau == 1) ? ((Feuille *)I->fils[i])->nb : ((Interne *)I->fils[i])->nb;
+    if (nbFils < MIN_CLES) reparerFils(I, i, niveau - 1);
+    return true;
+}
+
+/*
+ * @brief Supprime v de l'arbre B+
+ * @param A L'arbre B+
+ * @param v Valeur à supprimer
+ * Complexité : O(B log_B n)
+ */
+void supprimerBP(ArbreBP *A, int v){
+    if (!supprimerRec(A->racine, A->hauteur, v)) return;
+    A->taille--;
+    if (A->hauteur > 0 && ((Interne *)A->racine)->nb == 0){
+        // La racine n'a plus qu'un fils : l'arbre perd un niveau
+        void *ancienne = A->racine;
+        A->racine = ((Interne *)ancienne)->fils[0];
+        A->hauteur--;
+        free(ancienne);
+    }
+}
+
+// -------------------- Parcours ordonnés --------------------
+
+/*
+ * @brief Copie dans sortie les clés de [a, b] dans l'ordre croissant
+ * @param A L'arbre B+
+ * @param a Borne inférieure
+ * @param b Borne supérieure
+ * @param sortie Tableau résultat
+ * @param max Capacité de sortie
+ * @return size_t Nombre de clés copiées
+ * Complexité : O(B log_B n + k) où k = nombre de clés copiées
+ */
+size_t intervalleBP(const ArbreBP *A, int a, int b, int *sortie, size_t max){
+    size_t k = 0;
+    Feuille *F = trouverFeuille(A, a);
+    int i = positionFeuille(F, a);
+    while (F != NULL && k < max){
+        for (; i < F->nb && k < max; i++){
+            if (F->cles[i] > b) return k;
+            sortie[k++] = F->cles[i];
+        }
+        F = F->suivante;
+        i = 0;
+    }
+    return k;
+}
+
+// Première feuille (la plus à gauche)
+// Complexité : O(log_B n)
+Feuille *premiereFeuille(const ArbreBP *A){
+    void *noeud = A->racine;
+    for (int niveau = A->hauteur; niveau > 0; niveau--) noeud = ((Interne *)noeud)->fils[0];
+    return (Feuille *)noeud;
+}
+
+/*
+ * @brief Affiche les clés dans l'ordre croissant (équivalent de visiterInfixe)
+ *        en suivant la chaîne des feuilles, sans récursion
+ * @param A L'arbre B+
+ * Complexité : O(n)
+ */
+void visiterInfixeBP(const ArbreBP *A){
+    for (Feuille *F = premiereFeuille(A); F != NULL; F = F->suivante){
+        for (int i = 0; i < F->nb; i++) printf("%d ", F->cles[i]);
+    }
+}
+
+// -------------------- ABR de TD0 (référence) --------------------
+typedef struct Noeud {
+    int valeur;
+    struct Noeud *gauche;
+    struct Noeud *droit;
+} Noeud;
+
+typedef Noeud *Arbre;
+
+Arbre inserer(Arbre racine, int v){
+    if (racine == NULL){
+        racine = (Arbre)malloc(sizeof(Noeud));
+        if (racine == NULL){
+            perror("Erreur d'allocation dans inserer");
+            exit(EXIT_FAILURE);
+        }
+        racine->valeur = v;
+        racine->gauche = racine->droit = NULL;
+        return racine;
+    }
+    if (v < racine->valeur){
+        racine->gauche = inserer(racine->gauche, v);
+    } else if (v > racine->valeur){
+        racine->droit = inserer(racine->droit, v);
+    }
+    return racine;
+}
+
+Arbre rechercher(Arbre racine, int v){
+    if (racine == NULL || racine->valeur == v) return racine;
+    if (v > racine->valeur) return rechercher(racine->droit, v);
+    return rechercher(racine->gauche, v);
+}
+
+// Somme des valeurs en ordre infixe récursif
+long long sommeInfixe(Arbre racine){
+    if (racine == NULL) return 0;
+    return sommeInfixe(racine->gauche) + racine->valeur + sommeInfixe(racine->droit);
+}
+
+void detruireArbre(Arbre racine){
+    if (racine != NULL){
+        detruireArbre(racine->gauche);
+        detruireArbre(racine->droit);
+        free(racine);
+    }
+}
+
+// -------------------- Main pour tests --------------------
+double secondes(clock_t debut, clock_t fin){
+    return (double)(fin - debut) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[]){
+    // Petit exemple
+    ArbreBP A = creerBP();
+    for (int v = 1; v <= 40; v++) insererBP(&A, (v * 17) % 41);
+    for (int v = 1; v <= 40; v += 3) supprimerBP(&A, v);
+    printf("Arbre B+ (MAX_CLES = %d), %zu clés, hauteur %d :\n", MAX_CLES, A.taille, A.hauteur);
+    visiterInfixeBP(&A);
+    printf("\n");
+    int sortie[16];
+    size_t k = intervalleBP(&A, 10, 20, sortie, 16);
+    printf("Intervalle [10, 20] : ");
+    for (size_t i = 0; i < k; i++) printf("%d ", sortie[i]);
+    printf("\n");
+    detruireBP(&A);
+
+    // Comparaison avec l'ABR de TD0
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int *cles = (int *)calloc(n + 1, sizeof(int));
+    if (cles == NULL){
+        perror("Erreur d'allocation des clés");
+        exit(EXIT_FAILURE);
+    }
+    srand(42);
+    for (int i = 0; i < n; i++) cles[i] = rand();
+
+    Arbre racine = NULL;
+    A = creerBP();
+
+    clock_t t0 = clock();
+    for (int i = 0; i < n; i++) racine = inserer(racine, cles[i]);
+    clock_t t1 = clock();
+    for (int i = 0; i < n; i++) insererBP(&A, cles[i]);
+    clock_t t2 = clock();
+
+    int trouvesABR = 0, trouvesBP = 0;
+    for (int i = 0; i < n; i++) trouvesABR += (rechercher(racine, cles[i] ^ (i & 1)) != NULL);
+    clock_t t3 = clock();
+    for (int i = 0; i < n; i++) trouvesBP += rechercherBP(&A, cles[i] ^ (i & 1));
+    clock_t t4 = clock();
+
+    long long sommeABR = sommeInfixe(racine);
+    clock_t t5 = clock();
+    long long sommeBP = 0;
+    for (Feuille *F = premiereFeuille(&A); F != NULL; F = F->suivante){
+        for (int i = 0; i < F->nb; i++) sommeBP += F->cles[i];
+    }
+    clock_t t6 = clock();
+
+    printf("%d clés aléatoires :\n", n);
+    printf("  insertion  ABR %.3f s, B+ %.3f s\n", secondes(t0, t1), secondes(t1, t2));
+    printf("  recherche  ABR %.3f s, B+ %.3f s (trouvées %d / %d)\n",
+           secondes(t2, t3), secondes(t3, t4), trouvesABR, trouvesBP);
+    printf("  parcours   ABR %.3f s, B+ %.3f s (sommes %s)\n",
+           secondes(t4, t5), secondes(t5, t6), sommeABR == sommeBP ? "égales" : "différentes");
+
+    // Suppression de la moitié des clés puis vérification de l'ordre
+    for (int i = 0; i < n; i += 2) supprimerBP(&A, cles[i]);
+    bool trie = true;
+    int precedent = -1;
+    size_t compte = 0;
+    for (Feuille *F = premiereFeuille(&A); F != NULL; F = F->suivante){
+        for (int i = 0; i < F->nb; i++){
+            if (F->cles[i] <= precedent) trie = false;
+            precedent = F->cles[i];
+            compte++;
+        }
+    }
+    printf("  après suppressions : %zu clés, hauteur %d, ordre %s\n",
+           A.taille, A.hauteur, (trie && compte == A.taille) ? "correct" : "incorrect");
+
+    free(cles);
+    detruireArbre(racine);
+    detruireBP(&A);
+    return 0;
+}
@@ -0,0 +1,518 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+/*
+ * Arbres Binaires - Partage des sous-arbres identiques (DAG)
+ *
+ * Même après SIMPLIFIE, un arbre de couleurs contient beaucoup de sous-arbres
+ * identiques, et SontMiroirs (TD1) ou Elagage (examen 2023-2024) les comparent
+ * nœud par nœud à chaque appel.
+ *
+ * Le constructeur de DAG (hash-consing) ne crée jamais deux fois le même
+ * sous-arbre : un nœud (valeur, SAG, SAD) est cherché dans une table avant
+ * d'être alloué. Les fils étant déjà uniques, deux sous-arbres égaux sont le
+ * même pointeur :
+ * - égalité de deux sous-arbres : comparaison de pointeurs, O(1) ;
+ * - chaque nœud porte une empreinte structurelle (calculée à partir de la
+ *   valeur et des empreintes des fils) et l'empreinte de son miroir ; deux
+ *   empreintes différentes prouvent que les arbres diffèrent, en O(1) ;
+ * - le miroir d'un nœud est construit une fois puis mémorisé : SontMiroirs
+ *   devient miroir(A1) == A2 ;
+ * - Elagage s'arrête dès que les deux sous-arbres sont le même nœud et
+ *   mémorise les paires déjà vérifiées.
+ * Les nœuds sont découpés dans des tranches contiguës, comme dans Arene_Arbres.c.
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// -------------------- Définition de la structure --------------------
+typedef struct Noeud {
+    int valeur;
+    struct Noeud *SAG; // sous-arbre gauche
+    struct Noeud *SAD; // sous-arbre droit
+} Noeud;
+
+typedef Noeud *Arbre;
+
+typedef struct NoeudDAG {
+    int valeur;
+    const struct NoeudDAG *SAG;
+    const struct NoeudDAG *SAD;
+    uint64_t empreinte;             // empreinte du sous-arbre
+    uint64_t empreinte_miroir;      // empreinte de son miroir
+    const struct NoeudDAG *miroir;  // mémorisé au premier besoin
+    size_t taille;                  // nœuds de l'arbre déplié
+    struct NoeudDAG *suivant;       // chaînage dans la table
+} NoeudDAG;
+
+typedef const NoeudDAG *DAG;
+
+// Tranche : bloc contigu de nœuds, chaînées dans l'ordre d'allocation
+typedef struct Tranche {
+    struct Tranche *suivante;
+    size_t utilises;
+    NoeudDAG noeuds[];
+} Tranche;
+
+#define NOEUDS_PAR_TRANCHE 4096
+
+typedef struct {
+    NoeudDAG **alveoles;            // têtes des chaînes
+    size_t masque;                  // nombre d'alvéoles - 1 (puissance de deux)
+    size_t nb_noeuds;               // nœuds uniques
+    Tranche *tranches;
+} TableDAG;
+
+// -------------------- Empreintes --------------------
+
+static inline uint64_t melanger(uint64_t x){
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+#define EMPREINTE_VIDE 0x5A17C0DEULL
+
+// Empreinte d'un nœud à partir de sa valeur et des empreintes (ordonnées) de ses fils
+static inline uint64_t empreinteNoeud(int valeur, uint64_t g, uint64_t d){
+    return melanger(melanger((uint64_t)(uint32_t)valeur ^ (g * 0xD6E8FEB86659FD93ULL)) + d);
+}
+
+static inline uint64_t empreinte(DAG a){
+    return (a == NULL) ? EMPREINTE_VIDE : a->empreinte;
+}
+
+static inline uint64_t empreinteMiroir(DAG a){
+    return (a == NULL) ? EMPREINTE_VIDE : a->empreinte_miroir;
+}
+
+// -------------------- Table de hash-consing --------------------
+
+/*
+ * @brief Crée une table vide
+ * @return TableDAG La table
+ * Complexité : O(1)
+ */
+TableDAG creerTable(void){
+    TableDAG T = {NULL, 1023, 0, NULL};
+    T.alveoles = (NoeudDAG **)calloc(T.masque + 1, sizeof(NoeudDAG *));
+    if (T.alveoles == NULL){
+        perror("Erreur d'allocation dans creerTable");
+        exit(EXIT_FAILURE);
+    }
+    return T;
+}
+
+void detruireTable(TableDAG *T){
+    while (T->tranches != NULL){
+        Tranche *suivante = T->tranches->suivante;
+        free(T->tranches);
+        T->tranches = suivante;
+    }
+    free(T->alveoles);
+    *T = (TableDAG){NULL, 0, 0, NULL};
+}
+
+// Double le nombre d'alvéoles et y redistribue les nœuds
+// Complexité : O(nb_noeuds)
+static void agrandirTable(TableDAG *T){
+    size_t masque = 2 * T->masque + 1;
+    NoeudDAG **alveoles = (NoeudDAG **)calloc(masque + 1, sizeof(NoeudDAG *));
+    if (alveoles == NULL){
+        perror("Erreur d'allocation dans agrandirTable");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i <= T->masque; i++){
+        NoeudDAG *N = T->alveoles[i];
+        while (N != NULL){
+            NoeudDAG *suivant = N->suivant;
+            N->suivant = alveoles[N->empreinte & masque];
+            alveoles[N->empreinte & masque] = N;
+            N = suivant;
+        }
+    }
+    free(T->alveoles);
+    T->alveoles = alveoles;
+    T->masque = masque;
+}
+
+static NoeudDAG *allouerNoeud(TableDAG *T){
+    if (T->tranches == NULL || T->tranches->utilises == NOEUDS_PAR_TRANCHE){
+        Tranche *t = (Tranche *)malloc(sizeof(Tranche) + NOEUDS_PAR_TRANCHE * sizeof(NoeudDAG));
+        if (t == NULL){
+            perror("Erreur d'allocation dans allouerNoeud");
+            exit(EXIT_FAILURE);
+        }
+        t->suivante = T->tranches;
+        t->utilises = 0;
+        T->tranches = t;
+    }
+    return &T->tranches->noeuds[T->tranches->utilises++];
+}
+
+/*
+ * @brief Renvoie l'unique nœud (valeur, g, d) de la table, créé s'il n'existe pas
+ * @param T La table
+ * @param valeur Valeur du nœud
+ * @param g, d Fils, déjà uniques dans T (ou NULL)
+ * @return DAG Le nœud partagé
+ * Complexité : O(1) en moyenne
+ */
+DAG unique(TableDAG *T, int valeur, DAG g, DAG d){
+    uint64_t h = empreinteNoeud(valeur, empreinte(g), empreinte(d));
+    for (NoeudDAG *N = T->alveoles[h & T->masque]; N != NULL; N = N->suivant){
+        // Les fils sont uniques : les comparer comme pointeurs suffit
+        if (N->empreinte == h && N->valeur == valeur && N->SAG == g && N->SAD == d) return N;
+    }
+    if (T->nb_noeuds > T->masque) agrandirTable(T);
+    NoeudDAG *N = allouerNoeud(T);
+    N->valeur = valeur;
+    N->SAG = g;
+    N->SAD = d;
+    N->empreinte = h;
+    N->empreinte_miroir = empreinteNoeud(valeur, empreinteMiroir(d), empreinteMiroir(g));
+    N->miroir = NULL;
+    N->taille = 1 + (g ? g->taille : 0) + (d ? d->taille : 0);
+    N->suivant = T->alveoles[h & T->masque];
+    T->alveoles[h & T->masque] = N;
+    T->nb_noeuds++;
+    return N;
+}
+
+// -------------------- Conversions --------------------
+
+/*
+ * @brief Construit le DAG partagé d'un arbre
+ * @param T La table (les sous-arbres déjà présents sont réutilisés)
+ * @param A Racine de l'arbre
+ * @return DAG Racine du DAG
+ * Complexité : O(n) en moyenne
+ */
+DAG construireDAG(TableDAG *T, Arbre A){
+    if (A == NULL) return NULL;
+    DAG g = construireDAG(T, A->SAG);
+    DAG d = construireDAG(T, A->SAD);
+    return unique(T, A->valeur, g, d);
+}
+
+Arbre creerNoeud(int v){
+    Arbre N = (Arbre)malloc(sizeof(Noeud));
+    if (N == NULL){
+        perror("Erreur d'allocation dans creerNoeud");
+        exit(EXIT_FAILURE);
+    }
+    N->valeur = v;
+    N->SAG = N->SAD = NULL;
+    return N;
+}
+
+// Déplie le DAG en arbre de pointeurs (chaque partage est recopié)
+// Complexité : O(taille de l'arbre déplié)
+Arbre deplierDAG(DAG a){
+    if (a == NULL) return NULL;
+    Arbre A = creerNoeud(a->valeur);
+    A->SAG = deplierDAG(a->SAG);
+    A->SAD = deplierDAG(a->SAD);
+    return A;
+}
+
+// -------------------- Comparaisons sur le DAG --------------------
+
+// Égalité de deux sous-arbres d'une même table
+// Complexité : O(1)
+bool egauxDAG(DAG a, DAG b){
+    return a == b;
+}
+
+/*
+ * @brief Miroir d'un nœud, construit une fois puis mémorisé dans le nœud
+ * @param T La table de a
+ * @param a Le nœud
+ * @return DAG Le miroir, lui aussi unique dans T
+ * Complexité : O(nœuds uniques sans miroir mémorisé) au premier appel, O(1) ensuite
+ */
+DAG miroirDAG(TableDAG *T, DAG a){
+    if (a == NULL) return NULL;
+    if (a->miroir == NULL){
+        DAG m = unique(T, a->valeur, miroirDAG(T, a->SAD), miroirDAG(T, a->SAG));
+        ((NoeudDAG *)a)->miroir = m;
+        ((NoeudDAG *)m)->miroir = a;
+    }
+    return a->miroir;
+}
+
+/*
+ * @brief Vérifie si A1 et A2 sont miroirs l'un de l'autre
+ * @param T La table commune
+ * @param A1, A2 Racines
+ * @return bool Vrai si miroirs
+ * Complexité : O(1) si les empreintes diffèrent ou si le miroir est déjà connu
+ */
+bool SontMiroirs_DAG(TableDAG *T, DAG A1, DAG A2){
+    if (empreinteMiroir(A1) != empreinte(A2)) return false;
+    return miroirDAG(T, A1) == A2;
+}
+
+// Paires (a1, a2) pour lesquelles Elagage est déjà démontré
+typedef struct {
+    DAG *a1, *a2;
+    size_t masque, taille;
+} MemoPaires;
+
+static size_t alveolePaire(DAG a1, DAG a2, size_t masque){
+    return melanger(a1->empreinte ^ (a2->empreinte * 0x9E3779B97F4A7C15ULL)) & masque;
+}
+
+static bool memoContient(const MemoPaires *M, DAG a1, DAG a2){
+    if (M->a1 == NULL) return false;
+    for (size_t i = alveolePaire(a1, a2, M->masque); M->a1[i] != NULL; i = (i + 1) & M->masque)
+        if (M->a1[i] == a1 && M->a2[i] == a2) return true;
+    return false;
+}
+
+static void memoAjouter(MemoPaires *M, DAG a1, DAG a2){
+    if (M->a1 == NULL || 2 * (M->taille + 1) > M->masque + 1){
+        MemoPaires N = {NULL, NULL, (M->a1 == NULL) ? 63 : 2 * M->masque + 1, 0};
+        N.a1 = (DAG *)calloc(N.masque + 1, sizeof(DAG));
+        N.a2 = (DAG *)calloc(N.masque + 1, sizeof(DAG));
+        if (N.a1 == NULL || N.a2 == NULL){
+            perror("Erreur d'allocation dans memoAjouter");
+            exit(EXIT_FAILURE);
+        }
+        for (size_t i = 0; M->a1 != NULL && i <= M->masque; i++)
+            if (M->a1[i] != NULL) memoAjouter(&N, M->a1[i], M->a2[i]);
+        free(M->a1);
+        free(M->a2);
+        *M = N;
+    }
+    size_t i = alveolePaire(a1, a2, M->masque);
+    while (M->a1[i] != NULL) i = (i + 1) & M->masque;
+    M->a1[i] = a1;
+    M->a2[i] = a2;
+    M->taille++;
+}
+
+static bool elagageMemo(DAG a1, DAG a2, MemoPaires *M){
+    if (a1 == NULL) return true;
+    if (a2 == NULL) return false;
+    if (a1 == a2) return true;                              // un arbre est un élagage de lui-même
+    if (a1->SAG == NULL && a1->SAD == NULL) return true;
+    if (a1->valeur != a2->valeur) return false;
+    if (memoContient(M, a1, a2)) return true;
+    if (!elagageMemo(a1->SAG, a2->SAG, M) || !elagageMemo(a1->SAD, a2->SAD, M)) return false;
+    memoAjouter(M, a1, a2);
+    return true;
+}
+
+/*
+ * @brief Vérifie si a1 est un élagage de a2 (même définition que Elagage)
+ * @param a1, a2 Racines dans une même table
+ * @return bool Vrai si a1 est un élagage de a2
+ * Complexité : O(paires de nœuds uniques distinctes visitées), O(1) si a1 == a2
+ */
+bool Elagage_DAG(DAG a1, DAG a2){
+    MemoPaires M = {NULL, NULL, 0, 0};   // alloué à la première paire mémorisée
+    bool resultat = elagageMemo(a1, a2, &M);
+    free(M.a1);
+    free(M.a2);
+    return resultat;
+}
+
+// -------------------- Versions d'origine sur les pointeurs --------------------
+bool estFeuille(Arbre a){
+    return a != NULL && a->SAG == NULL && a->SAD == NULL;
+}
+
+bool SontMiroirs(Arbre A1, Arbre A2){
+    if (A1 == NULL && A2 == NULL) return true;
+    if (A1 == NULL || A2 == NULL || A1->valeur != A2->valeur) return false;
+    return SontMiroirs(A1->SAG, A2->SAD) && SontMiroirs(A1->SAD, A2->SAG);
+}
+
+bool Elagage(Arbre a1, Arbre a2){
+    if (a1 == NULL) return true;
+    if (a2 == NULL) return false;
+    if (estFeuille(a1)) return true;
+    if (a1->valeur != a2->valeur) return false;
+    return Elagage(a1->SAG, a2->SAG) && Elagage(a1->SAD, a2->SAD);
+}
+
+bool arbresEgaux(Arbre a, Arbre b){
+    if (a == NULL || b == NULL) return a == b;
+    return a->valeur == b->valeur && arbresEgaux(a->SAG, b->SAG) && arbresEgaux(a->SAD, b->SAD);
+}
+
+void SIMPLIFIE(Arbre *a){
+    if (*a == NULL || estFeuille(*a)) return;
+    SIMPLIFIE(&((*a)->SAG));
+    SIMPLIFIE(&((*a)->SAD));
+    if (estFeuille((*a)->SAG) && estFeuille((*a)->SAD) && (*a)->SAG->valeur == (*a)->SAD->valeur){
+        int c = (*a)->SAG->valeur;
+        free((*a)->SAG);
+        free((*a)->SAD);
+        (*a)->SAG = (*a)->SAD = NULL;
+        (*a)->valeur = c;
+    }
+}
+
+// -------------------- Arbres de test --------------------
+int compterNoeuds(Arbre A){
+    if (A == NULL) return 0;
+    return 1 + compterNoeuds(A->SAG) + compterNoeuds(A->SAD);
+}
+
+Arbre copierMiroir(Arbre A){
+    if (A == NULL) return NULL;
+    Arbre M = creerNoeud(A->valeur);
+    M->SAG = copierMiroir(A->SAD);
+    M->SAD = copierMiroir(A->SAG);
+    return M;
+}
+
+void detruireArbre(Arbre A){
+    if (A == NULL) return;
+    detruireArbre(A->SAG);
+    detruireArbre(A->SAD);
+    free(A);
+}
+
+/*
+ * Image noir et blanc découpée en deux récursivement : une zone unie ou trop
+ * petite devient une feuille, un nœud interne porte la couleur de son centre.
+ * L'image est une grille de MOTIF x MOTIF disques noirs : MOTIF n'étant pas
+ * une puissance de deux, les disques ne tombent pas tous au même endroit des
+ * zones découpées, mais beaucoup de morceaux de bord se répètent.
+ */
+#define MOTIF 6
+#define RAYON 0.3           // en fraction de la taille d'une case
+
+int couleurPoint(double x, double y){
+    double fx = MOTIF * x - (int)(MOTIF * x) - 0.5, fy = MOTIF * y - (int)(MOTIF * y) - 0.5;
+    return fx * fx + fy * fy >= RAYON * RAYON;
+}
+
+// 0 : zone entièrement noire, 1 : entièrement blanche, -1 : mélangée
+int couleurZone(double x0, double y0, double x1, double y1){
+    bool noir = false, blanc = false;
+    for (int i = (int)(MOTIF * x0); i <= (int)(MOTIF * x1) && i < MOTIF; i++){
+        for (int j = (int)(MOTIF * y0); j <= (int)(MOTIF * y1) && j < MOTIF; j++){
+            // Distances minimale et maximale du centre du disque à la partie de la zone dans la case
+            double cx = (i + 0.5) / MOTIF, cy = (j + 0.5) / MOTIF, r = RAYON / MOTIF;
+            double ax = (x0 > (double)i / MOTIF) ? x0 : (double)i / MOTIF;
+            double bx = (x1 < (double)(i + 1) / MOTIF) ? x1 : (double)(i + 1) / MOTIF;
+            double ay = (y0 > (double)j / MOTIF) ? y0 : (double)j / MOTIF;
+            double by = (y1 < (double)(j + 1) / MOTIF) ? y1 : (double)(j + 1) / MOTIF;
+            if (ax >= bx || ay >= by) continue;
+            double px = (cx < ax) ? ax : (cx > bx) ? bx : cx, py = (cy < ay) ? ay : (cy > by) ? by : cy;
+            double qx = (cx - ax > bx - cx) ? ax : bx, qy = (cy - ay > by - cy) ? ay : by;
+            double dmin = (px - cx) * (px - cx) + (py - cy) * (py - cy);
+            double dmax = (qx - cx) * (qx - cx) + (qy - cy) * (qy - cy);
+            if (dmin < r * r) noir = true;
+            if (dmax >= r * r) blanc = true;
+        }
+    }
+    return (noir && blanc) ? -1 : blanc;
+}
+
+Arbre decouper(double x0, double y0, double x1, double y1, int profondeur){
+    int c = couleurZone(x0, y0, x1, y1);
+    if (c >= 0) return creerNoeud(c);
+    Arbre A = creerNoeud(couleurPoint((x0 + x1) / 2, (y0 + y1) / 2));
+    if (profondeur == 0) return A;
+    if (profondeur % 2 == 0){
+        double xm = (x0 + x1) / 2;
+        A->SAG = decouper(x0, y0, xm, y1, profondeur - 1);
+        A->SAD = decouper(xm, y0, x1, y1, profondeur - 1);
+    } else {
+        double ym = (y0 + y1) / 2;
+        A->SAG = decouper(x0, y0, x1, ym, profondeur - 1);
+        A->SAD = decouper(x0, ym, x1, y1, profondeur - 1);
+    }
+    return A;
+}
+
+// Range dans tab les nœuds de profondeur p (pointeurs et DAG parcourus ensemble)
+void noeudsProfondeur(Arbre A, DAG a, int p, Arbre *tab, DAG *tab_dag, int *nb, int max){
+    if (A == NULL || *nb == max) return;
+    if (p == 0){
+        tab[*nb] = A;
+        tab_dag[(*nb)++] = a;
+        return;
+    }
+    noeudsProfondeur(A->SAG, a->SAG, p - 1, tab, tab_dag, nb, max);
+    noeudsProfondeur(A->SAD, a->SAD, p - 1, tab, tab_dag, nb, max);
+}
+
+double secondes(clock_t debut){
+    return (double)(clock() - debut) / CLOCKS_PER_SEC;
+}
+
+// -------------------- Main pour tester --------------------
+int main(int argc, char *argv[]){
+    int profondeur = (argc > 1) ? atoi(argv[1]) : 30;
+    Arbre A = decouper(0, 0, 1, 1, profondeur);
+    SIMPLIFIE(&A);
+    int n = compterNoeuds(A);
+
+    TableDAG T = creerTable();
+    clock_t t0 = clock();
+    DAG D = construireDAG(&T, A);
+    double construction = secondes(t0);
+    Arbre B = deplierDAG(D);
+    printf("Image simplifiée de profondeur %d : %d nœuds, %zu nœuds uniques (compression %.1f), "
+           "construction %.3f s, dépliage %s\n", profondeur, n, T.nb_noeuds, (double)n / T.nb_noeuds,
+           construction, (arbresEgaux(A, B) && D->taille == (size_t)n) ? "identique" : "différent");
+    printf("Mémoire : %zu octets en pointeurs, %zu octets de DAG\n", n * sizeof(Noeud),
+           T.nb_noeuds * sizeof(NoeudDAG) + (T.masque + 1) * sizeof(NoeudDAG *));
+
+    // SontMiroirs sur l'arbre entier et son miroir
+    Arbre M = copierMiroir(A);
+    DAG Dm = construireDAG(&T, M);
+    t0 = clock();
+    bool p1 = SontMiroirs(A, M), p2 = SontMiroirs(A, B);
+    double d_pointeurs = secondes(t0);
+    t0 = clock();
+    bool m1 = SontMiroirs_DAG(&T, D, Dm);
+    double d_premier = secondes(t0);
+    t0 = clock();
+    bool m2 = SontMiroirs_DAG(&T, D, D) && SontMiroirs_DAG(&T, D, Dm);
+    printf("SontMiroirs(A, miroir) : %s / %s, SontMiroirs(A, A) : %s / %s ; pointeurs %.4f s, "
+           "DAG %.4f s au premier appel puis %.6f s\n", p1 ? "Vrai" : "Faux", m1 ? "Vrai" : "Faux",
+           p2 ? "Vrai" : "Faux", m2 ? "Vrai" : "Faux", d_pointeurs, d_premier, secondes(t0));
+
+    // Comparaisons répétées entre sous-arbres d'une même profondeur
+    enum { MAX = 1500 };
+    static Arbre sous[MAX];
+    static DAG sous_dag[MAX];
+    int nb = 0, p = profondeur / 3;
+    noeudsProfondeur(A, D, p, sous, sous_dag, &nb, MAX);
+    long egaux = 0, egaux_dag = 0, miroirs = 0, miroirs_dag = 0, elag = 0, elag_dag = 0;
+    t0 = clock();
+    for (int i = 0; i < nb; i++)
+        for (int j = 0; j < nb; j++){
+            egaux += arbresEgaux(sous[i], sous[j]);
+            miroirs += SontMiroirs(sous[i], sous[j]);
+            elag += Elagage(sous[i], sous[j]);
+        }
+    d_pointeurs = secondes(t0);
+    t0 = clock();
+    for (int i = 0; i < nb; i++)
+        for (int j = 0; j < nb; j++){
+            egaux_dag += egauxDAG(sous_dag[i], sous_dag[j]);
+            miroirs_dag += SontMiroirs_DAG(&T, sous_dag[i], sous_dag[j]);
+            elag_dag += Elagage_DAG(sous_dag[i], sous_dag[j]);
+        }
+    printf("%d x %d paires de sous-arbres de profondeur %d : égaux %ld / %ld, miroirs %ld / %ld, "
+           "élagages %ld / %ld ; pointeurs %.3f s, DAG %.3f s\n", nb, nb, p, egaux, egaux_dag,
+           miroirs, miroirs_dag, elag, elag_dag, d_pointeurs, secondes(t0));
+
+    detruireArbre(A);
+    detruireArbre(B);
+    detruireArbre(M);
+    detruireTable(&T);
+    return 0;
+}
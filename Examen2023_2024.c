@@ -24,6 +24,8 @@ typedef struct Noeud {
 
 typedef Noeud *Arbre;
 
+#include "Arene_Arbres.h"   // après Noeud : l'arène en dépend
+
 // -------------------- Fonctions utilitaires --------------------
 
 // Vérifie si un nœud est une feuille
@@ -85,20 +87,30 @@ bool TOUTBLANC(Arbre a) {
 
 // -------------------- Simplification de l'arbre --------------------
 
-// Simplifie l'arbre : si deux feuilles de même couleur sont filles d'un nœud,
-// elles sont supprimées et le nœud devient une feuille
+// Crée un nœud de couleur v pris dans l'arène A (NULL : malloc)
+// Complexité : O(1) amorti
+Arbre creerNoeud_Arene(Arene *A, Arbre G, Arbre D, int v) {
+    Arbre N = nouveauNoeud(A);
+    N->valeur = v;
+    N->SAG = G;
+    N->SAD = D;
+    return N;
+}
+
+// Version de SIMPLIFIE pour un arbre dont les nœuds viennent de l'arène A :
+// les feuilles supprimées y sont recyclées (A == NULL : elles sont libérées par free)
 // Complexité : O(n)
-void SIMPLIFIE(Arbre *a) {
+void SIMPLIFIE_Arene(Arene *A, Arbre *a) {
     if (*a == NULL || estFeuille(*a)) return;
 
-    SIMPLIFIE(&((*a)->SAG));
-    SIMPLIFIE(&((*a)->SAD));
+    SIMPLIFIE_Arene(A, &((*a)->SAG));
+    SIMPLIFIE_Arene(A, &((*a)->SAD));
 
     if (estFeuille((*a)->SAG) && estFeuille((*a)->SAD)) {
         if ((*a)->SAG->valeur == (*a)->SAD->valeur) {
             int couleur = (*a)->SAG->valeur;
-            free((*a)->SAG);
-            free((*a)->SAD);
+            rendreNoeud(A, (*a)->SAG);
+            rendreNoeud(A, (*a)->SAD);
             (*a)->SAG = NULL;
             (*a)->SAD = NULL;
             (*a)->valeur = couleur;
@@ -106,6 +118,13 @@ void SIMPLIFIE(Arbre *a) {
     }
 }
 
+// Simplifie l'arbre : si deux feuilles de même couleur sont filles d'un nœud,
+// elles sont supprimées et le nœud devient une feuille
+// Complexité : O(n)
+void SIMPLIFIE(Arbre *a) {
+    SIMPLIFIE_Arene(NULL, a);
+}
+
 // -------------------- Comptage de nœuds internes --------------------
 
 // Compte les nœuds internes à profondeur P
@@ -195,5 +214,17 @@ int main() {
     free(racine->SAD);
     free(racine);
 
+    // Arbre de couleurs construit dans une arène : SIMPLIFIE y recycle les
+    // feuilles supprimées et tout l'arbre est libéré d'un coup
+    Arene *arene = creerArene(16);
+    Arbre couleurs = creerNoeud_Arene(arene,
+        creerNoeud_Arene(arene, creerNoeud_Arene(arene, NULL, NULL, 0), creerNoeud_Arene(arene, NULL, NULL, 0), 2),
+        creerNoeud_Arene(arene, creerNoeud_Arene(arene, NULL, NULL, 1), creerNoeud_Arene(arene, NULL, NULL, 1), 2), 2);
+    SIMPLIFIE_Arene(arene, &couleurs);
+    printf("Après SIMPLIFIE : SAG %s de couleur %d, SAD %s de couleur %d\n",
+           estFeuille(couleurs->SAG) ? "feuille" : "interne", couleurs->SAG->valeur,
+           estFeuille(couleurs->SAD) ? "feuille" : "interne", couleurs->SAD->valeur);
+    detruireArene(arene);
+
     return 0;
 }
@@ -24,6 +24,8 @@ typedef struct Noeud {
 
 typedef Noeud *Arbre; // Arbre désigne la racine
 
+#include "Arene_Arbres.h"   // après Noeud : l'arène en dépend
+
 // -------------------- Fonctions sur les arbres --------------------
 
 // -------------------- Nombre de petits-fils feuilles --------------------
@@ -65,14 +67,15 @@ int CompteQueuesDeCerises(Arbre A) {
 }
 
 // -------------------- Création de queues de cerises à profondeur P --------------------
+// Les deux feuilles ajoutées sont prises dans l'arène Ar (NULL : malloc)
 // Complexité : O(n)
-void RPQDCPP(Arbre *A, int P) {
+void RPQDCPP_Arene(Arene *Ar, Arbre *A, int P) {
     if (*A == NULL) return;
 
     if (P == 0) {
         if ((*A)->SAG == NULL && (*A)->SAD == NULL) {
-            (*A)->SAG = malloc(sizeof(Noeud));
-            (*A)->SAD = malloc(sizeof(Noeud));
+            (*A)->SAG = nouveauNoeud(Ar);
+            (*A)->SAD = nouveauNoeud(Ar);
             (*A)->SAG->SAG = NULL;
             (*A)->SAG->SAD = NULL;
             (*A)->SAD->SAG = NULL;
@@ -81,8 +84,13 @@ void RPQDCPP(Arbre *A, int P) {
         return;
     }
 
-    RPQDCPP(&((*A)->SAG), P - 1);
-    RPQDCPP(&((*A)->SAD), P - 1);
+    RPQDCPP_Arene(Ar, &((*A)->SAG), P - 1);
+    RPQDCPP_Arene(Ar, &((*A)->SAD), P - 1);
+}
+
+// Complexité : O(n)
+void RPQDCPP(Arbre *A, int P) {
+    RPQDCPP_Arene(NULL, A, P);
 }
 
 // -------------------- Compte nœuds internes >= x dans un ABR --------------------
@@ -194,5 +202,20 @@ int main() {
     free(racine->SAD);
     free(racine);
 
+    // Même arbre construit dans une arène : les feuilles ajoutées par
+    // RPQDCPP_Arene y sont prises et tout est libéré d'un coup
+    Arene *arene = creerArene(8);
+    Arbre cerises = nouveauNoeud(arene);
+    cerises->valeur = 1;
+    cerises->SAG = nouveauNoeud(arene);
+    cerises->SAG->valeur = 1;
+    cerises->SAG->SAG = cerises->SAG->SAD = NULL;
+    cerises->SAD = nouveauNoeud(arene);
+    cerises->SAD->valeur = 0;
+    cerises->SAD->SAG = cerises->SAD->SAD = NULL;
+    RPQDCPP_Arene(arene, &cerises, 1);
+    printf("Queues de cerises après RPQDCPP à profondeur 1: %d\n", CompteQueuesDeCerises(cerises));
+    detruireArene(arene);
+
     return 0;
 }
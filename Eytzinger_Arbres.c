@@ -0,0 +1,283 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/*
+ * Arbres Binaires - Instantané figé d'un ABR (disposition d'Eytzinger)
+ *
+ * Un ABR de TD0 construit une fois puis interrogé des millions de fois
+ * paie un défaut de cache à chaque nœud visité par rechercher.
+ * L'opération figer copie les valeurs de l'arbre dans un tableau rangé
+ * en largeur (ordre d'Eytzinger) : les fils de la case k sont les cases
+ * 2k et 2k+1. Les premiers niveaux tiennent dans quelques lignes de cache
+ * et la recherche n'a plus besoin de pointeurs :
+ * - rechercherFige : recherche sans branchement avec préchargement
+ * - rechercherFigeLot : recherche d'un lot de clés (AVX2 si disponible)
+ *
+ * Compilation conseillée : gcc -O2 -march=native Eytzinger_Arbres.c
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// -------------------- Définition de la structure --------------------
+typedef struct Noeud {
+    int valeur;
+    struct Noeud *gauche;   // sous-arbre gauche
+    struct Noeud *droit;    // sous-arbre droit
+} Noeud;
+
+typedef Noeud *Arbre;
+
+// Instantané figé : t[1..n] en ordre d'Eytzinger, t[0] inutilisé
+typedef struct {
+    int *t;
+    size_t n;
+} ArbreFige;
+
+#define LIGNE_CACHE 64
+#define VALEURS_PAR_LIGNE (LIGNE_CACHE / sizeof(int))
+
+// -------------------- Opérations de TD0 --------------------
+Arbre creerNoeud(int v){
+    Arbre nouveau_noeud = (Arbre)malloc(sizeof(Noeud));
+    if (nouveau_noeud == NULL){
+        perror("Erreur d'allocation dans creerNoeud");
+        exit(EXIT_FAILURE);
+    }
+    nouveau_noeud->valeur = v;
+    nouveau_noeud->gauche = NULL;
+    nouveau_noeud->droit = NULL;
+    return nouveau_noeud;
+}
+
+Arbre inserer(Arbre racine, int v){
+    if (racine == NULL) return creerNoeud(v);
+    if (v < racine->valeur){
+        racine->gauche = inserer(racine->gauche, v);
+    } else if (v > racine->valeur){
+        racine->droit = inserer(racine->droit, v);
+    }
+    return racine;
+}
+
+Arbre rechercher(Arbre racine, int v){
+    if (racine == NULL || racine->valeur == v) return racine;
+    if (v > racine->valeur) return rechercher(racine->droit, v);
+    return rechercher(racine->gauche, v);
+}
+
+void detruireArbre(Arbre racine){
+    if (racine != NULL){
+        detruireArbre(racine->gauche);
+        detruireArbre(racine->droit);
+        free(racine);
+    }
+}
+
+// -------------------- Construction de l'instantané --------------------
+
+// Nombre de nœuds de l'arbre
+// Complexité : O(n)
+size_t compterNoeuds(Arbre racine){
+    if (racine == NULL) return 0;
+    return 1 + compterNoeuds(racine->gauche) + compterNoeuds(racine->droit);
+}
+
+// Copie les valeurs en ordre infixe (donc triées pour un ABR)
+// Complexité : O(n)
+void copierInfixe(Arbre racine, int *trie, size_t *i){
+    if (racine == NULL) return;
+    copierInfixe(racine->gauche, trie, i);
+    trie[(*i)++] = racine->valeur;
+    copierInfixe(racine->droit, trie, i);
+}
+
+// Range le tableau trié dans t : parcours infixe de l'arbre implicite 2k / 2k+1
+// Complexité : O(n)
+void remplirEytzinger(int *t, size_t n, const int *trie, size_t *i, size_t k){
+    if (k > n) return;
+    remplirEytzinger(t, n, trie, i, 2 * k);
+    t[k] = trie[(*i)++];
+    remplirEytzinger(t, n, trie, i, 2 * k + 1);
+}
+
+/*
+ * @brief Construit l'instantané figé d'un ABR ; l'arbre n'est pas modifié
+ * @param racine Racine de l'ABR
+ * @return ArbreFige Le tableau d'Eytzinger (aligné sur une ligne de cache)
+ * Complexité : O(n)
+ */
+ArbreFige figer(Arbre racine){
+    ArbreFige F;
+    F.n = compterNoeuds(racine);
+
+    int *trie = (int *)malloc((F.n + 1) * sizeof(int));
+    // Taille arrondie à la ligne de cache, exigée par aligned_alloc
+    size_t octets = ((F.n + 1) * sizeof(int) + LIGNE_CACHE - 1) / LIGNE_CACHE * LIGNE_CACHE;
+    F.t = (int *)aligned_alloc(LIGNE_CACHE, octets);
+    if (trie == NULL || F.t == NULL){
+        perror("Erreur d'allocation dans figer");
+        exit(EXIT_FAILURE);
+    }
+
+    size_t i = 0;
+    copierInfixe(racine, trie, &i);
+    i = 0;
+    F.t[0] = 0;
+    remplirEytzinger(F.t, F.n, trie, &i, 1);
+
+    free(trie);
+    return F;
+}
+
+void libererFige(ArbreFige *F){
+    free(F->t);
+    F->t = NULL;
+    F->n = 0;
+}
+
+// -------------------- Recherche dans l'instantané --------------------
+
+/*
+ * @brief Termine une descente : k a dépassé n, on retire les virages à droite
+ *        finaux et le dernier virage à gauche pour retrouver le plus petit
+ *        élément >= v, puis on teste l'égalité
+ * @return size_t L'indice de v dans t, 0 si absent
+ * Complexité : O(1)
+ */
+static inline size_t terminerDescente(const ArbreFige *F, size_t k, int v){
+    k >>= __builtin_ffsll((long long)~k);
+    return (k != 0 && F->t[k] == v) ? k : 0;
+}
+
+/*
+ * @brief Recherche v sans branchement dans la boucle : seule la condition
+ *        d'arrêt est un saut, toujours bien prédit ; la ligne de cache
+ *        contenant les descendants quatre niveaux plus bas est préchargée
+ * @param F L'instantané
+ * @param v Valeur cherchée
+ * @return size_t L'indice de v dans F->t, 0 si absent (même réponse que rechercher)
+ * Complexité : O(log n)
+ */
+size_t rechercherFige(const ArbreFige *F, int v){
+    size_t k = 1;
+    while (k <= F->n){
+        // Adresse calculée sur des entiers : près des feuilles elle dépasse le
+        // tableau, ce qui est sans danger pour un préchargement mais interdit
+        // en arithmétique de pointeurs
+        __builtin_prefetch((const void *)((uintptr_t)F->t + k * VALEURS_PAR_LIGNE * sizeof(int)));
+        k = 2 * k + (F->t[k] < v);
+    }
+    return terminerDescente(F, k, v);
+}
+
+/*
+ * @brief Recherche un lot de m clés ; les descentes avancent en parallèle
+ *        pour recouvrir les accès mémoire (8 clés par registre AVX2)
+ * @param F L'instantané (au-delà de 2^30 éléments, les indices 32 bits
+ *        d'AVX2 ne suffisent plus et les descentes restent scalaires)
+ * @param cles Clés cherchées
+ * @param res Indices résultats (0 si absent)
+ * @param m Nombre de clés
+ * Complexité : O(m log n)
+ */
+void rechercherFigeLot(const ArbreFige *F, const int *cles, size_t *res, size_t m){
+    size_t i = 0;
+#ifdef __AVX2__
+    // k va jusqu'à 2n + 1, qui doit tenir dans un int32
+    const bool indices32 = F->n < ((size_t)1 << 30);
+    const __m256i un = _mm256_set1_epi32(1);
+    const __m256i limite = _mm256_set1_epi32(indices32 ? (int)F->n + 1 : 0);
+    for (; indices32 && i + 8 <= m; i += 8){
+        __m256i v = _mm256_loadu_si256((const __m256i *)(cles + i));
+        __m256i k = un;
+        for (;;){
+            __m256i actif = _mm256_cmpgt_epi32(limite, k);           // k <= n
+            if (_mm256_testz_si256(actif, actif)) break;
+            __m256i t = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), F->t, k, actif, 4);
+            __m256i droite = _mm256_and_si256(_mm256_cmpgt_epi32(v, t), actif);
+            k = _mm256_add_epi32(k, _mm256_and_si256(k, actif));    // k = 2k si actif
+            k = _mm256_sub_epi32(k, droite);                         // + 1 si t[k] < v
+        }
+        int ks[8];
+        _mm256_storeu_si256((__m256i *)ks, k);
+        for (int j = 0; j < 8; j++) res[i + j] = terminerDescente(F, (size_t)ks[j], cles[i + j]);
+    }
+#endif
+    // Sans AVX2 (ou n trop grand) : 8 descentes entrelacées, le processeur
+    // recouvre leurs défauts de cache
+    for (; i + 8 <= m; i += 8){
+        size_t k[8];
+        for (int j = 0; j < 8; j++) k[j] = 1;
+        bool actif = true;
+        while (actif){
+            actif = false;
+            for (int j = 0; j < 8; j++){
+                size_t suivant = 2 * k[j] + (F->t[k[j] <= F->n ? k[j] : 0] < cles[i + j]);
+                k[j] = (k[j] <= F->n) ? suivant : k[j];
+                actif |= (k[j] <= F->n);
+            }
+        }
+        for (int j = 0; j < 8; j++) res[i + j] = terminerDescente(F, k[j], cles[i + j]);
+    }
+    for (; i < m; i++) res[i] = rechercherFige(F, cles[i]);
+}
+
+// -------------------- Main pour tests --------------------
+int main(int argc, char *argv[]){
+    size_t n = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+    size_t m = (argc > 2) ? strtoul(argv[2], NULL, 10) : 2000000;
+
+    int plage = (n > 0) ? (int)(2 * n) : 1;
+
+    Arbre racine = NULL;
+    srand(42);
+    for (size_t i = 0; i < n; i++) racine = inserer(racine, rand() % plage);
+
+    ArbreFige F = figer(racine);
+    printf("ABR : %zu valeurs distinctes figées\n", F.n);
+
+    int *cles = (int *)calloc(m + 1, sizeof(int));
+    size_t *res = (size_t *)malloc(m * sizeof(size_t));
+    if (cles == NULL || res == NULL){
+        perror("Erreur d'allocation des requêtes");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < m; i++) cles[i] = rand() % plage;
+
+    clock_t t0 = clock();
+    size_t trouvesArbre = 0;
+    for (size_t i = 0; i < m; i++) trouvesArbre += (rechercher(racine, cles[i]) != NULL);
+    clock_t t1 = clock();
+    size_t trouvesFige = 0;
+    for (size_t i = 0; i < m; i++) trouvesFige += (rechercherFige(&F, cles[i]) != 0);
+    clock_t t2 = clock();
+    rechercherFigeLot(&F, cles, res, m);
+    clock_t t3 = clock();
+
+    size_t trouvesLot = 0;
+    bool coherent = true;
+    for (size_t i = 0; i < m; i++){
+        trouvesLot += (res[i] != 0);
+        if ((res[i] != 0) != (rechercher(racine, cles[i]) != NULL)) coherent = false;
+        if (res[i] != 0 && F.t[res[i]] != cles[i]) coherent = false;
+    }
+
+    printf("%zu recherches :\n", m);
+    printf("  rechercher        %.3f s (%zu trouvées)\n", (double)(t1 - t0) / CLOCKS_PER_SEC, trouvesArbre);
+    printf("  rechercherFige    %.3f s (%zu trouvées)\n", (double)(t2 - t1) / CLOCKS_PER_SEC, trouvesFige);
+    printf("  rechercherFigeLot %.3f s (%zu trouvées)\n", (double)(t3 - t2) / CLOCKS_PER_SEC, trouvesLot);
+    printf("Mêmes réponses que rechercher : %s\n",
+           (coherent && trouvesFige == trouvesArbre) ? "Oui" : "Non");
+
+    free(cles);
+    free(res);
+    libererFige(&F);
+    detruireArbre(racine);
+    return 0;
+}
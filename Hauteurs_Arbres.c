@@ -0,0 +1,376 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <time.h>
+
+/*
+ * Arbres Binaires - Nœuds augmentés (hauteur et propriétés mémorisées)
+ *
+ * Dans les examens, hauteur est recalculée à chaque appel : ArbreFibonacci_V1
+ * (examen 2024-2025) l'appelle en chaque nœud et coûte O(n^2), et EstABR
+ * (examen 2023-2024) reparcourt tout l'arbre après chaque modification.
+ * Ici chaque nœud mémorise, pour son sous-arbre :
+ * - sa hauteur ;
+ * - le nombre de nœuds déséquilibrés (|hG - hD| > 1) ;
+ * - ses valeurs minimale et maximale et s'il s'agit d'un ABR.
+ * Ces champs se calculent en O(1) à partir de ceux des fils (majNoeud). Chaque
+ * modification (inserer, supprimerNoeud, greffer, SIMPLIFIE, RPQDCPP) les remet
+ * à jour sur le chemin qu'elle a parcouru, en remontant. Après chaque
+ * modification, hauteur, ArbreFibonacci et EstABR se lisent donc en O(1).
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// -------------------- Définition de la structure --------------------
+typedef struct Noeud {
+    int valeur;
+    int hauteur;            // hauteur du sous-arbre (0 pour une feuille)
+    int nbDesequilibres;    // nœuds du sous-arbre où |hG - hD| > 1
+    int min, max;           // plus petite et plus grande valeur du sous-arbre
+    bool estABR;            // le sous-arbre est un ABR (valeurs distinctes, ni INT_MIN ni INT_MAX comme à l'examen)
+    struct Noeud *SAG;      // sous-arbre gauche
+    struct Noeud *SAD;      // sous-arbre droit
+} Noeud;
+
+typedef Noeud *Arbre;
+
+// -------------------- Fonctions utilitaires --------------------
+int maximum(int a, int b){
+    return (a > b) ? a : b;
+}
+
+int minimum(int a, int b){
+    return (a < b) ? a : b;
+}
+
+bool estFeuille(Arbre a){
+    return a != NULL && a->SAG == NULL && a->SAD == NULL;
+}
+
+bool estInterne(Arbre a){
+    return a != NULL && (a->SAG != NULL || a->SAD != NULL);
+}
+
+// Hauteur mémorisée, -1 pour l'arbre vide
+// Complexité : O(1)
+int hauteur(Arbre A){
+    if (A == NULL) return -1;
+    return A->hauteur;
+}
+
+// Différence hG - hD
+// Complexité : O(1)
+int desequilibre(Arbre A){
+    return hauteur(A->SAG) - hauteur(A->SAD);
+}
+
+int nbDesequilibres(Arbre A){
+    return (A == NULL) ? 0 : A->nbDesequilibres;
+}
+
+/*
+ * @brief Recalcule les champs mémorisés d'un nœud à partir de ceux de ses fils
+ * @param A Nœud dont les fils sont à jour
+ * Complexité : O(1)
+ */
+void majNoeud(Arbre A){
+    Arbre G = A->SAG, D = A->SAD;
+    int d = desequilibre(A);
+    A->hauteur = 1 + maximum(hauteur(G), hauteur(D));
+    A->nbDesequilibres = nbDesequilibres(G) + nbDesequilibres(D) + (d > 1 || d < -1);
+    A->min = A->max = A->valeur;
+    if (G != NULL){ A->min = minimum(A->min, G->min); A->max = maximum(A->max, G->max); }
+    if (D != NULL){ A->min = minimum(A->min, D->min); A->max = maximum(A->max, D->max); }
+    // Comme EstABR de l'examen (bornes strictes -2147483648 et 2147483647),
+    // INT_MIN et INT_MAX ne sont pas acceptés
+    A->estABR = A->valeur > INT_MIN && A->valeur < INT_MAX &&
+                (G == NULL || (G->estABR && G->max < A->valeur)) &&
+                (D == NULL || (D->estABR && D->min > A->valeur));
+}
+
+// -------------------- Création d'un nœud --------------------
+Arbre creerNoeud(int v){
+    Arbre N = (Arbre)malloc(sizeof(Noeud));
+    if (N == NULL){
+        perror("Erreur d'allocation dans creerNoeud");
+        exit(EXIT_FAILURE);
+    }
+    N->valeur = v;
+    N->SAG = NULL;
+    N->SAD = NULL;
+    majNoeud(N);
+    return N;
+}
+
+void detruireArbre(Arbre A){
+    if (A == NULL) return;
+    detruireArbre(A->SAG);
+    detruireArbre(A->SAD);
+    free(A);
+}
+
+// -------------------- Requêtes en O(1) --------------------
+
+// Tous les nœuds vérifient |hG - hD| <= 1 (arbre de type Fibonacci / AVL)
+// Complexité : O(1)
+bool ArbreFibonacci(Arbre A){
+    return nbDesequilibres(A) == 0;
+}
+
+// Complexité : O(1)
+bool EstABR(Arbre A){
+    return A == NULL || A->estABR;
+}
+
+// -------------------- Modifications --------------------
+
+/*
+ * @brief Insertion dans un ABR (comme TD0, sans doublon), champs remis à jour
+ *        sur le chemin de descente
+ * @param A Racine
+ * @param v Valeur à insérer
+ * @return Arbre La racine
+ * Complexité : O(h)
+ */
+Arbre inserer(Arbre A, int v){
+    if (A == NULL) return creerNoeud(v);
+    if (v < A->valeur){
+        A->SAG = inserer(A->SAG, v);
+    } else if (v > A->valeur){
+        A->SAD = inserer(A->SAD, v);
+    } else {
+        return A;
+    }
+    majNoeud(A);
+    return A;
+}
+
+/*
+ * @brief Suppression dans un ABR (comme TD0), champs remis à jour sur le chemin
+ * @param A Racine
+ * @param v Valeur à supprimer
+ * @return Arbre La racine
+ * Complexité : O(h)
+ */
+Arbre supprimerNoeud(Arbre A, int v){
+    if (A == NULL) return NULL;
+    if (v < A->valeur){
+        A->SAG = supprimerNoeud(A->SAG, v);
+    } else if (v > A->valeur){
+        A->SAD = supprimerNoeud(A->SAD, v);
+    } else {
+        if (A->SAG == NULL || A->SAD == NULL){
+            Arbre fils = (A->SAG != NULL) ? A->SAG : A->SAD;
+            free(A);
+            return fils;
+        }
+        Arbre succ = A->SAD;
+        while (succ->SAG != NULL) succ = succ->SAG;
+        A->valeur = succ->valeur;
+        A->SAD = supprimerNoeud(A->SAD, succ->valeur);
+    }
+    majNoeud(A);
+    return A;
+}
+
+/*
+ * @brief Accroche une nouvelle feuille au bout d'un chemin, pour les arbres
+ *        qui ne sont pas des ABR. Le chemin est une suite de 'G' et 'D' depuis
+ *        la racine ; sa dernière lettre désigne la place libre à occuper.
+ * @param A Pointeur vers la racine
+ * @param chemin Chemin vers la place de la feuille ("" : racine d'un arbre vide)
+ * @param v Valeur de la feuille
+ * @return false si le chemin traverse un arbre vide ou si la place est prise
+ * Complexité : O(longueur du chemin)
+ */
+bool greffer(Arbre *A, const char *chemin, int v){
+    if (*chemin == '\0'){
+        if (*A != NULL) return false;
+        *A = creerNoeud(v);
+        return true;
+    }
+    if (*A == NULL) return false;
+    Arbre *fils = (*chemin == 'G') ? &(*A)->SAG : &(*A)->SAD;
+    if (!greffer(fils, chemin + 1, v)) return false;
+    majNoeud(*A);
+    return true;
+}
+
+// Simplifie l'arbre : deux feuilles sœurs de même couleur sont fusionnées
+// dans leur père (examen 2023-2024)
+// Complexité : O(n)
+void SIMPLIFIE(Arbre *a){
+    if (*a == NULL || estFeuille(*a)) return;
+    SIMPLIFIE(&((*a)->SAG));
+    SIMPLIFIE(&((*a)->SAD));
+    if (estFeuille((*a)->SAG) && estFeuille((*a)->SAD) && (*a)->SAG->valeur == (*a)->SAD->valeur){
+        (*a)->valeur = (*a)->SAG->valeur;
+        free((*a)->SAG);
+        free((*a)->SAD);
+        (*a)->SAG = NULL;
+        (*a)->SAD = NULL;
+    }
+    majNoeud(*a);
+}
+
+// Remplace chaque feuille à profondeur P par une queue de cerises (examen
+// 2024-2025). Les deux nouvelles feuilles valent 0 (l'original ne les
+// initialisait pas).
+// Complexité : O(nombre de nœuds de profondeur <= P)
+void RPQDCPP(Arbre *A, int P){
+    if (*A == NULL) return;
+    if (P == 0){
+        if (estFeuille(*A)){
+            (*A)->SAG = creerNoeud(0);
+            (*A)->SAD = creerNoeud(0);
+            majNoeud(*A);
+        }
+        return;
+    }
+    RPQDCPP(&((*A)->SAG), P - 1);
+    RPQDCPP(&((*A)->SAD), P - 1);
+    majNoeud(*A);
+}
+
+// -------------------- Requêtes utilisant les hauteurs --------------------
+
+/*
+ * @brief Nœuds internes de hauteur h ; les sous-arbres de hauteur < h sont
+ *        écartés sans être parcourus
+ * Complexité : O(nombre de nœuds de hauteur >= h)
+ */
+int CompteNoeudsInternesHauteurH(Arbre A, int h){
+    if (A == NULL || A->hauteur < h) return 0;
+    if (A->hauteur == h) return estInterne(A) ? 1 : 0;
+    return CompteNoeudsInternesHauteurH(A->SAG, h) + CompteNoeudsInternesHauteurH(A->SAD, h);
+}
+
+/*
+ * @brief Nœuds non nuls du dernier niveau (CompteHEgalP de TD1) ; seuls les
+ *        sous-arbres qui atteignent le dernier niveau sont parcourus
+ * @param A Racine
+ * @param profondeur Profondeur de A
+ * @param h Hauteur de l'arbre entier
+ * Complexité : O(nombre de nœuds ayant un descendant au dernier niveau)
+ */
+int compteDernierNiveau(Arbre A, int profondeur, int h){
+    if (A == NULL || profondeur + A->hauteur != h) return 0;
+    if (A->hauteur == 0) return A->valeur != 0;
+    return compteDernierNiveau(A->SAG, profondeur + 1, h) + compteDernierNiveau(A->SAD, profondeur + 1, h);
+}
+
+int CompteHEgalP(Arbre A){
+    return compteDernierNiveau(A, 0, hauteur(A));
+}
+
+// -------------------- Versions de référence (recalcul complet) --------------------
+
+int hauteurRecalculee(Arbre A){
+    if (A == NULL) return -1;
+    return 1 + maximum(hauteurRecalculee(A->SAG), hauteurRecalculee(A->SAD));
+}
+
+// ArbreFibonacci_V1 de l'examen 2024-2025
+// Complexité : O(n^2)
+bool ArbreFibonacci_V1(Arbre A){
+    if (A == NULL) return true;
+    int hg = hauteurRecalculee(A->SAG);
+    int hd = hauteurRecalculee(A->SAD);
+    if (hg - hd > 1 || hd - hg > 1) return false;
+    return ArbreFibonacci_V1(A->SAG) && ArbreFibonacci_V1(A->SAD);
+}
+
+bool estABR_Util(Arbre a, long min, long max){
+    if (a == NULL) return true;
+    if (a->valeur <= min || a->valeur >= max) return false;
+    return estABR_Util(a->SAG, min, a->valeur) && estABR_Util(a->SAD, a->valeur, max);
+}
+
+// EstABR de l'examen 2023-2024
+// Complexité : O(n)
+bool EstABR_V1(Arbre a){
+    return estABR_Util(a, -2147483648L, 2147483647L);
+}
+
+/*
+ * @brief Vérifie que tous les champs mémorisés correspondent à un recalcul
+ * Complexité : O(n)
+ */
+bool verifierChamps(Arbre A){
+    if (A == NULL) return true;
+    if (!verifierChamps(A->SAG) || !verifierChamps(A->SAD)) return false;
+    Noeud copie = *A;
+    majNoeud(&copie);
+    return copie.hauteur == A->hauteur && A->hauteur == hauteurRecalculee(A) &&
+           copie.nbDesequilibres == A->nbDesequilibres && copie.min == A->min &&
+           copie.max == A->max && copie.estABR == A->estABR;
+}
+
+// -------------------- Main pour tester --------------------
+int main(int argc, char *argv[]){
+    // Arbre de couleurs : racine noire, deux fils, feuilles blanches
+    Arbre C = NULL;
+    greffer(&C, "", 0);
+    greffer(&C, "G", 1);
+    greffer(&C, "D", 0);
+    greffer(&C, "DG", 1);
+    greffer(&C, "DD", 1);
+    printf("Hauteur %d, Fibonacci %s, ABR %s\n", hauteur(C), ArbreFibonacci(C) ? "oui" : "non", EstABR(C) ? "oui" : "non");
+    greffer(&C, "DGG", 1);
+    greffer(&C, "DGGD", 0);
+    printf("Après deux greffes : hauteur %d, Fibonacci %s (V1 : %s)\n", hauteur(C),
+           ArbreFibonacci(C) ? "oui" : "non", ArbreFibonacci_V1(C) ? "oui" : "non");
+    RPQDCPP(&C, 1);
+    printf("Après RPQDCPP(1) : hauteur %d, nœuds déséquilibrés %d\n", hauteur(C), nbDesequilibres(C));
+    SIMPLIFIE(&C);
+    printf("Après SIMPLIFIE : hauteur %d, nœuds déséquilibrés %d, CompteHEgalP %d, champs %s\n",
+           hauteur(C), nbDesequilibres(C), CompteHEgalP(C), verifierChamps(C) ? "cohérents" : "incohérents");
+    detruireArbre(C);
+    C = creerNoeud(INT_MAX);
+    printf("Nœud seul %d : ABR %s (EstABR_V1 : %s)\n", INT_MAX, EstABR(C) ? "oui" : "non", EstABR_V1(C) ? "oui" : "non");
+    detruireArbre(C);
+
+    // ABR : propriétés relues après chaque insertion et suppression aléatoire
+    int n = (argc > 1) ? atoi(argv[1]) : 3000;
+    Arbre A = NULL;
+    srand(1);
+    bool coherent = true;
+    int fibo = 0, fibo_V1 = 0, abr = 0, abr_V1 = 0;
+    clock_t t0 = clock();
+    for (int i = 0; i < n; i++){
+        A = inserer(A, rand() % (4 * n));
+        if (i % 3 == 2) A = supprimerNoeud(A, rand() % (4 * n));
+        // Clés limites, refusées par EstABR de l'examen, pendant une partie des étapes
+        if (i == n / 3) A = inserer(A, INT_MAX);
+        if (i == n / 2) A = supprimerNoeud(A, INT_MAX);
+        if (i == 2 * n / 3) A = inserer(A, INT_MIN);
+        fibo += ArbreFibonacci(A);
+        abr += EstABR(A);
+    }
+    clock_t t1 = clock();
+    Arbre B = NULL;
+    srand(1);
+    for (int i = 0; i < n; i++){
+        B = inserer(B, rand() % (4 * n));
+        if (i % 3 == 2) B = supprimerNoeud(B, rand() % (4 * n));
+        if (i == n / 3) B = inserer(B, INT_MAX);
+        if (i == n / 2) B = supprimerNoeud(B, INT_MAX);
+        if (i == 2 * n / 3) B = inserer(B, INT_MIN);
+        fibo_V1 += ArbreFibonacci_V1(B);
+        abr_V1 += EstABR_V1(B);
+    }
+    clock_t t2 = clock();
+    coherent = coherent && verifierChamps(A) && fibo == fibo_V1 && abr == abr_V1 && abr < n &&
+               EstABR(A) == EstABR_V1(A);
+
+    printf("%d modifications d'un ABR, contrôle Fibonacci et ABR après chacune :\n", n);
+    printf("  champs mémorisés %.4f s, recalcul (V1 + EstABR) %.4f s, résultats %s\n",
+           (double)(t1 - t0) / CLOCKS_PER_SEC, (double)(t2 - t1) / CLOCKS_PER_SEC,
+           coherent ? "identiques" : "différents");
+    printf("  hauteur finale %d, nœuds internes de hauteur 2 : %d\n", hauteur(A), CompteNoeudsInternesHauteurH(A, 2));
+
+    detruireArbre(A);
+    detruireArbre(B);
+    return 0;
+}
@@ -0,0 +1,379 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+/*
+ * Arbres Binaires - Index des niveaux
+ *
+ * CompteNoeudsInternesProfondeurP (examen 2023-2024), CompteFVraiProfondeurP et
+ * RPQDCPP (examen 2024-2025) parcourent tous les nœuds de profondeur < P pour
+ * atteindre le niveau P. Quand on les appelle pour beaucoup de P sur le même
+ * arbre, tout ce travail est refait à chaque fois.
+ *
+ * L'index des niveaux, facultatif, range les nœuds de chaque profondeur dans
+ * un tableau contigu :
+ * - il est construit en un seul parcours en largeur (le niveau d sert de file
+ *   pour remplir le niveau d + 1) ;
+ * - chaque nœud connaît sa profondeur et son rang dans son niveau, ce qui
+ *   permet de le retirer en O(1) (le dernier du niveau prend sa place) ;
+ * - ajouterFils, supprimerSousArbre et RPQDCPP le tiennent à jour.
+ * Une requête ou une modification à profondeur P coûte alors O(k), où k est le
+ * nombre de nœuds du niveau P. Chaque fonction accepte un index NULL et se
+ * rabat alors sur le parcours récursif d'origine.
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// -------------------- Définition de la structure --------------------
+typedef struct Noeud {
+    int valeur;
+    int profondeur;     // tenus à jour par l'index
+    size_t rang;        // position dans le tableau de son niveau
+    struct Noeud *SAG;  // sous-arbre gauche
+    struct Noeud *SAD;  // sous-arbre droit
+} Noeud;
+
+typedef Noeud *Arbre;
+
+typedef struct {
+    Arbre *noeuds;
+    size_t taille, capacite;
+} Niveau;
+
+typedef struct {
+    Niveau *niveaux;
+    int nb_niveaux;     // niveaux non vides : hauteur + 1
+    int capacite;
+} IndexNiveaux;
+
+bool estFeuille(Arbre a){
+    return a != NULL && a->SAG == NULL && a->SAD == NULL;
+}
+
+bool estInterne(Arbre a){
+    return a != NULL && (a->SAG != NULL || a->SAD != NULL);
+}
+
+Arbre creerNoeud(int v){
+    Arbre N = (Arbre)malloc(sizeof(Noeud));
+    if (N == NULL){
+        perror("Erreur d'allocation dans creerNoeud");
+        exit(EXIT_FAILURE);
+    }
+    N->valeur = v;
+    N->profondeur = 0;
+    N->rang = 0;
+    N->SAG = N->SAD = NULL;
+    return N;
+}
+
+// -------------------- Gestion des niveaux --------------------
+
+// Niveau d, créé vide s'il n'existe pas encore
+// Complexité : O(1) amorti
+Niveau *niveau(IndexNiveaux *I, int d){
+    if (d >= I->capacite){
+        int capacite = (I->capacite == 0) ? 16 : 2 * I->capacite;
+        while (capacite <= d) capacite *= 2;
+        Niveau *niveaux = (Niveau *)realloc(I->niveaux, capacite * sizeof(Niveau));
+        if (niveaux == NULL){
+            perror("Erreur d'allocation dans niveau");
+            exit(EXIT_FAILURE);
+        }
+        for (int i = I->capacite; i < capacite; i++) niveaux[i] = (Niveau){NULL, 0, 0};
+        I->niveaux = niveaux;
+        I->capacite = capacite;
+    }
+    if (d >= I->nb_niveaux) I->nb_niveaux = d + 1;
+    return &I->niveaux[d];
+}
+
+// Ajoute a au niveau d (fixe sa profondeur et son rang)
+// Complexité : O(1) amorti
+void indexer(IndexNiveaux *I, Arbre a, int d){
+    Niveau *N = niveau(I, d);
+    if (N->taille == N->capacite){
+        N->capacite = (N->capacite == 0) ? 16 : 2 * N->capacite;
+        Arbre *noeuds = (Arbre *)realloc(N->noeuds, N->capacite * sizeof(Arbre));
+        if (noeuds == NULL){
+            perror("Erreur d'allocation dans indexer");
+            exit(EXIT_FAILURE);
+        }
+        N->noeuds = noeuds;
+    }
+    a->profondeur = d;
+    a->rang = N->taille;
+    N->noeuds[N->taille++] = a;
+}
+
+// Retire a de son niveau : le dernier nœud du niveau prend sa place
+// Complexité : O(1)
+void desindexer(IndexNiveaux *I, Arbre a){
+    Niveau *N = &I->niveaux[a->profondeur];
+    Arbre dernier = N->noeuds[--N->taille];
+    N->noeuds[a->rang] = dernier;
+    dernier->rang = a->rang;
+    while (I->nb_niveaux > 0 && I->niveaux[I->nb_niveaux - 1].taille == 0) I->nb_niveaux--;
+}
+
+/*
+ * @brief Construit l'index des niveaux en un parcours en largeur
+ * @param A Racine de l'arbre
+ * @return IndexNiveaux L'index (vide si A est vide)
+ * Complexité : O(n)
+ */
+IndexNiveaux construireIndex(Arbre A){
+    IndexNiveaux I = {NULL, 0, 0};
+    if (A == NULL) return I;
+    indexer(&I, A, 0);
+    for (int d = 0; d < I.nb_niveaux; d++){
+        // I.niveaux peut être réalloué par indexer : on relit le niveau à chaque tour
+        for (size_t i = 0; i < I.niveaux[d].taille; i++){
+            Arbre a = I.niveaux[d].noeuds[i];
+            if (a->SAG != NULL) indexer(&I, a->SAG, d + 1);
+            if (a->SAD != NULL) indexer(&I, a->SAD, d + 1);
+        }
+    }
+    return I;
+}
+
+void detruireIndex(IndexNiveaux *I){
+    for (int d = 0; d < I->capacite; d++) free(I->niveaux[d].noeuds);
+    free(I->niveaux);
+    *I = (IndexNiveaux){NULL, 0, 0};
+}
+
+// Hauteur de l'arbre indexé (-1 pour l'arbre vide)
+// Complexité : O(1)
+int hauteurIndex(const IndexNiveaux *I){
+    return I->nb_niveaux - 1;
+}
+
+// Nombre de nœuds à profondeur P
+// Complexité : O(1)
+size_t tailleNiveau(const IndexNiveaux *I, int P){
+    return (P < 0 || P >= I->nb_niveaux) ? 0 : I->niveaux[P].taille;
+}
+
+// -------------------- Requêtes à profondeur P --------------------
+
+/*
+ * @brief Compte les nœuds internes à profondeur p
+ * @param I Index des niveaux de a, ou NULL
+ * @param a Racine de l'arbre
+ * @param p Profondeur
+ * @return int Nombre de nœuds internes à profondeur p
+ * Complexité : O(k) avec l'index (k nœuds au niveau p), O(n) sans
+ */
+int CompteNoeudsInternesProfondeurP(const IndexNiveaux *I, Arbre a, int p){
+    if (I == NULL){
+        if (a == NULL) return 0;
+        if (p == 0) return estInterne(a);
+        return CompteNoeudsInternesProfondeurP(NULL, a->SAG, p - 1) +
+               CompteNoeudsInternesProfondeurP(NULL, a->SAD, p - 1);
+    }
+    int cpt = 0;
+    for (size_t i = 0; i < tailleNiveau(I, p); i++) cpt += estInterne(I->niveaux[p].noeuds[i]);
+    return cpt;
+}
+
+/*
+ * @brief Compte les feuilles valant 1 à profondeur P
+ * @param I Index des niveaux de A, ou NULL
+ * @param A Racine de l'arbre
+ * @param P Profondeur
+ * @return int Nombre de feuilles vraies à profondeur P
+ * Complexité : O(k) avec l'index, O(n) sans
+ */
+int CompteFVraiProfondeurP(const IndexNiveaux *I, Arbre A, int P){
+    if (I == NULL){
+        if (A == NULL) return 0;
+        if (P == 0) return estFeuille(A) && A->valeur == 1;
+        return CompteFVraiProfondeurP(NULL, A->SAG, P - 1) + CompteFVraiProfondeurP(NULL, A->SAD, P - 1);
+    }
+    int cpt = 0;
+    for (size_t i = 0; i < tailleNiveau(I, P); i++){
+        Arbre a = I->niveaux[P].noeuds[i];
+        cpt += estFeuille(a) && a->valeur == 1;
+    }
+    return cpt;
+}
+
+// -------------------- Modifications --------------------
+
+/*
+ * @brief Remplace chaque feuille de profondeur P par une queue de cerises
+ *        (deux nouvelles feuilles de valeur 0)
+ * @param I Index des niveaux de *A, ou NULL
+ * @param A Pointeur sur la racine
+ * @param P Profondeur
+ * Complexité : O(k) avec l'index (les nouvelles feuilles sont ajoutées au
+ *              niveau P + 1), O(n) sans
+ */
+void RPQDCPP(IndexNiveaux *I, Arbre *A, int P){
+    if (*A == NULL) return;
+    if (I == NULL){
+        if (P == 0){
+            if (estFeuille(*A)){
+                (*A)->SAG = creerNoeud(0);
+                (*A)->SAD = creerNoeud(0);
+            }
+            return;
+        }
+        RPQDCPP(NULL, &(*A)->SAG, P - 1);
+        RPQDCPP(NULL, &(*A)->SAD, P - 1);
+        return;
+    }
+    size_t k = tailleNiveau(I, P);
+    for (size_t i = 0; i < k; i++){
+        Arbre a = I->niveaux[P].noeuds[i];
+        if (!estFeuille(a)) continue;
+        a->SAG = creerNoeud(0);
+        a->SAD = creerNoeud(0);
+        indexer(I, a->SAG, P + 1);
+        indexer(I, a->SAD, P + 1);
+    }
+}
+
+/*
+ * @brief Ajoute une feuille v comme fils gauche ou droit de parent
+ * @param I Index des niveaux, ou NULL
+ * @param parent Nœud de l'arbre (le fils visé doit être vide)
+ * @param droite Côté du nouveau fils
+ * @param v Valeur de la feuille
+ * @return Arbre La nouvelle feuille
+ * Complexité : O(1) amorti
+ */
+Arbre ajouterFils(IndexNiveaux *I, Arbre parent, bool droite, int v){
+    Arbre f = creerNoeud(v);
+    if (droite) parent->SAD = f;
+    else parent->SAG = f;
+    if (I != NULL) indexer(I, f, parent->profondeur + 1);
+    return f;
+}
+
+/*
+ * @brief Détache et libère le sous-arbre *place en le retirant de l'index
+ * @param I Index des niveaux, ou NULL
+ * @param place Pointeur (dans le parent, ou la racine) sur le sous-arbre
+ * Complexité : O(taille du sous-arbre)
+ */
+void supprimerSousArbre(IndexNiveaux *I, Arbre *place){
+    Arbre a = *place;
+    if (a == NULL) return;
+    supprimerSousArbre(I, &a->SAG);
+    supprimerSousArbre(I, &a->SAD);
+    if (I != NULL) desindexer(I, a);
+    free(a);
+    *place = NULL;
+}
+
+// -------------------- Vérification et tests --------------------
+
+// Vérifie l'index contre un parcours : mêmes tailles de niveaux, profondeurs et rangs cohérents
+bool verifierIndex(const IndexNiveaux *I, Arbre A){
+    bool ok = true;
+    for (int d = 0; ok && d < I->nb_niveaux; d++){
+        for (size_t i = 0; ok && i < I->niveaux[d].taille; i++){
+            Arbre a = I->niveaux[d].noeuds[i];
+            ok = (a->rang == i && a->profondeur == d);
+        }
+    }
+    // construireIndex réécrit profondeur et rang : on rétablit ensuite ceux de I
+    IndexNiveaux J = construireIndex(A);
+    ok = ok && (J.nb_niveaux == I->nb_niveaux);
+    for (int d = 0; ok && d < I->nb_niveaux; d++) ok = (I->niveaux[d].taille == J.niveaux[d].taille);
+    for (int d = 0; d < I->nb_niveaux; d++){
+        for (size_t i = 0; i < I->niveaux[d].taille; i++){
+            I->niveaux[d].noeuds[i]->profondeur = d;
+            I->niveaux[d].noeuds[i]->rang = i;
+        }
+    }
+    detruireIndex(&J);
+    return ok;
+}
+
+Arbre inserer(Arbre A, int v){
+    Arbre *place = &A;
+    while (*place != NULL){
+        if (v == (*place)->valeur) return A;
+        place = (v < (*place)->valeur) ? &(*place)->SAG : &(*place)->SAD;
+    }
+    *place = creerNoeud(v);
+    return A;
+}
+
+void detruireArbre(Arbre A){
+    if (A == NULL) return;
+    detruireArbre(A->SAG);
+    detruireArbre(A->SAD);
+    free(A);
+}
+
+// Valeurs 0 / 1 pseudo-aléatoires, pour que CompteFVraiProfondeurP ait quelque chose à compter
+void colorier(Arbre A){
+    if (A == NULL) return;
+    A->valeur &= 1;
+    colorier(A->SAG);
+    colorier(A->SAD);
+}
+
+// -------------------- Main pour tester --------------------
+int main(int argc, char *argv[]){
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    Arbre A = NULL;
+    srand(11);
+    for (int i = 0; i < n; i++) A = inserer(A, rand() % (4 * n));
+
+    clock_t t0 = clock();
+    IndexNiveaux I = construireIndex(A);
+    clock_t t1 = clock();
+    int h = hauteurIndex(&I);
+    printf("ABR aléatoire : hauteur %d, index construit en %.3f s\n", h, (double)(t1 - t0) / CLOCKS_PER_SEC);
+    colorier(A);
+
+    // Toutes les profondeurs, avec et sans index
+    long total_sans = 0, total_avec = 0;
+    t0 = clock();
+    for (int p = 0; p <= h; p++)
+        total_sans += CompteNoeudsInternesProfondeurP(NULL, A, p) + CompteFVraiProfondeurP(NULL, A, p);
+    t1 = clock();
+    for (int p = 0; p <= h; p++)
+        total_avec += CompteNoeudsInternesProfondeurP(&I, A, p) + CompteFVraiProfondeurP(&I, A, p);
+    clock_t t2 = clock();
+    printf("Requêtes pour P = 0..%d : sans index %.3f s, avec index %.3f s, résultats %s\n", h,
+           (double)(t1 - t0) / CLOCKS_PER_SEC, (double)(t2 - t1) / CLOCKS_PER_SEC,
+           (total_sans == total_avec) ? "identiques" : "différents");
+
+    // Modifications en masse à une profondeur : les deux arbres doivent rester identiques
+    Arbre B = NULL;
+    srand(11);
+    for (int i = 0; i < n; i++) B = inserer(B, rand() % (4 * n));
+    colorier(B);
+    int profondeurs[] = {h / 4, h / 3, h / 2, 2 * h / 3, 3 * h / 4};
+    t0 = clock();
+    for (int i = 0; i < 5; i++) RPQDCPP(NULL, &B, profondeurs[i]);
+    t1 = clock();
+    for (int i = 0; i < 5; i++) RPQDCPP(&I, &A, profondeurs[i]);
+    t2 = clock();
+    bool memes = verifierIndex(&I, A);
+    for (int p = 0; p <= hauteurIndex(&I) + 1; p++)
+        memes = memes && CompteNoeudsInternesProfondeurP(NULL, B, p) == CompteNoeudsInternesProfondeurP(&I, A, p);
+    printf("RPQDCPP pour P = %d, %d, %d, %d, %d : sans index %.3f s, avec index %.3f s, arbres %s\n",
+           profondeurs[0], profondeurs[1], profondeurs[2], profondeurs[3], profondeurs[4],
+           (double)(t1 - t0) / CLOCKS_PER_SEC, (double)(t2 - t1) / CLOCKS_PER_SEC,
+           memes ? "identiques" : "différents");
+
+    // Modifications ponctuelles
+    supprimerSousArbre(&I, &A->SAG);
+    Arbre f = ajouterFils(&I, A, false, 1);
+    ajouterFils(&I, f, true, 1);
+    printf("Après suppression du sous-arbre gauche : hauteur %d, feuilles vraies à profondeur 2 : %d, index %s\n",
+           hauteurIndex(&I), CompteFVraiProfondeurP(&I, A, 2), verifierIndex(&I, A) ? "cohérent" : "incohérent");
+
+    detruireIndex(&I);
+    detruireArbre(A);
+    detruireArbre(B);
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdbool.h>
 
 /*
  * Portfolio GitHub - Listes et PPQ
@@ -8,6 +9,11 @@
  * dans un intervalle [p1, p2] dont la somme vaut q. 
  * Les listes sont représentées par des structures chaînées (Bloc), 
  * et les ensembles de listes par BlocDeBlocs.
+ * PPQ_flux énumère les mêmes solutions sans les stocker.
+ * TablePPQ compte les solutions sans les énumérer et donne accès direct
+ * à la k-ième solution (et au rang d'une solution).
+ * Les variantes contraintes (suites croissantes, strictement croissantes,
+ * longueur bornée) élaguent les branches qui ne peuvent plus aboutir.
  *
  * Chaque fonction est commentée et la complexité est indiquée.
  */
@@ -15,7 +21,8 @@
 // -------------------- Structures --------------------
 typedef struct Bloc {
     int valeur;
-    struct Bloc *suivant;
+    int references;          // nombre de détenteurs (listes, maillons, Blocs précédents)
+    struct Bloc *suivant;    // suffixe, éventuellement partagé par plusieurs solutions
 } *Bloc;
 
 typedef struct BlocDeBlocs {
@@ -26,10 +33,11 @@ typedef struct BlocDeBlocs {
 // -------------------- Fonctions sur Bloc --------------------
 
 /*
- * @brief Ajoute un entier en tête d'une liste (Bloc)
+ * @brief Ajoute un entier en tête d'une liste (Bloc) ; la liste B n'est pas
+ *        copiée mais partagée : le nouveau maillon en détient une référence
  * @param element La valeur entière à ajouter
  * @param B La tête de la liste existante
- * @return Bloc La nouvelle tête de la liste
+ * @return Bloc La nouvelle tête de la liste (une référence, détenue par l'appelant)
  * Complexité : O(1)
  */
 Bloc AjouterEnTete(int element, Bloc B){
@@ -39,19 +47,22 @@ Bloc AjouterEnTete(int element, Bloc B){
         exit(EXIT_FAILURE);
     }
     nouveau_bloc->valeur = element; 
+    nouveau_bloc->references = 1;
     nouveau_bloc->suivant = B; 
+    if (B != NULL) B->references++;
     return nouveau_bloc;
 }
 
 /*
- * @brief Libère tous les maillons d'une seule liste d'entiers (Bloc)
+ * @brief Rend une référence sur une liste d'entiers (Bloc) : les maillons
+ *        qui ne sont plus détenus par personne sont libérés
  * @param B La tête de la liste
- * Complexité : O(n) où n est la longueur de la liste
+ * Complexité : O(k) où k est le nombre de maillons libérés
  */
 void LibererBloc(Bloc B){
     Bloc courant = B;
     Bloc suivant_temp; 
-    while (courant != NULL){
+    while (courant != NULL && --courant->references == 0){
         suivant_temp = courant->suivant; 
         free(courant);
         courant = suivant_temp;
@@ -98,9 +109,10 @@ BlocDeBlocs CreerBlocDeBlocs(Bloc B, BlocDeBlocs suivant){
 }
 
 /*
- * @brief Libère l'intégralité d'une liste de BlocDeBlocs
+ * @brief Libère l'intégralité d'une liste de BlocDeBlocs ; les suffixes
+ *        encore partagés avec d'autres solutions sont conservés
  * @param BB La tête de la liste de BlocDeBlocs
- * Complexité : O(n*m) où n = longueur de BB, m = longueur moyenne des Blocs
+ * Complexité : O(n + k) où n = longueur de BB, k = nombre de Blocs libérés
  */
 void LibererBlocDeBlocs(BlocDeBlocs BB){
     BlocDeBlocs courant = BB; 
@@ -117,41 +129,394 @@ void LibererBlocDeBlocs(BlocDeBlocs BB){
 
 /*
  * @brief Génère toutes les listes d'entiers dans [p1, p2] dont la somme vaut q
- * @param p1 Borne inférieure
+ *
+ * Les solutions de chaque somme r = 0..q sont calculées une seule fois
+ * (mémoïsation) : solutions(r) = { i + s | p1 <= i <= p2, s dans solutions(r - i) }.
+ * La solution i + s partage le Bloc s au lieu de le recopier (comptage de
+ * références) : l'ensemble des solutions forme un graphe de suffixes partagés
+ * et chaque Bloc correspond à un suffixe distinct. Les listes de solutions
+ * sont construites avec un pointeur de queue (ajout en O(1)).
+ * solutions(r) n'est plus utile une fois solutions(r + p2) calculé.
+ *
+ * @param p1 Borne inférieure (p1 >= 1, sinon il y a une infinité de solutions)
  * @param p2 Borne supérieure
  * @param q Somme cible
  * @return BlocDeBlocs La liste de toutes les solutions
- * Complexité : Exponentielle O((p2-p1+1)^q) dans le pire cas
+ * Complexité : O(S) en temps et en mémoire, où S = nombre total de solutions
+ *              de toutes les sommes r <= q (au lieu de leur longueur cumulée)
  */
 BlocDeBlocs PPQ(int p1, int p2, int q){
     if (q == 0) return CreerBlocDeBlocs(NULL, NULL); // solution vide
-    if (q < p1) return NULL; // impossible
-
-    BlocDeBlocs resultat = NULL;
-
-    for (int i = p1; i <= p2; i++){
-        int q_restant = q - i;
-        if (q_restant >= 0){
-            BlocDeBlocs solutionsIntermediaires = PPQ(p1, p2, q_restant); 
-            if (solutionsIntermediaires != NULL){
-                BlocDeBlocs solutionsPrefixees = NULL; 
-                BlocDeBlocs courant_intermediaire = solutionsIntermediaires;
-
-                while (courant_intermediaire != NULL){
-                    Bloc NouvelleListe = AjouterEnTete(i, courant_intermediaire->solution);
-                    BlocDeBlocs NouveauMaillon = CreerBlocDeBlocs(NouvelleListe, NULL); 
-                    solutionsPrefixees = Concatener(solutionsPrefixees, NouveauMaillon); 
-                    courant_intermediaire = courant_intermediaire->suivant;
-                }
-
-                resultat = Concatener(resultat, solutionsPrefixees);
-                LibererBlocDeBlocs(solutionsIntermediaires);
+    if (q < p1 || p1 < 1 || p2 < p1) return NULL; // impossible
+
+    BlocDeBlocs *memo = (BlocDeBlocs *)calloc(q + 1, sizeof(BlocDeBlocs));
+    if (memo == NULL) {
+        perror("Erreur d'allocation dans PPQ");
+        exit(EXIT_FAILURE);
+    }
+    memo[0] = CreerBlocDeBlocs(NULL, NULL);
+
+    for (int r = 1; r <= q; r++){
+        BlocDeBlocs tete = NULL;
+        BlocDeBlocs *queue = &tete;
+
+        for (int i = p1; i <= p2 && i <= r; i++){
+            for (BlocDeBlocs s = memo[r - i]; s != NULL; s = s->suivant){
+                *queue = CreerBlocDeBlocs(AjouterEnTete(i, s->solution), NULL);
+                queue = &(*queue)->suivant;
             }
         }
+        memo[r] = tete;
+
+        // Les sommes r' > r n'utilisent plus memo[r - p2]
+        if (r - p2 >= 0){
+            LibererBlocDeBlocs(memo[r - p2]);
+            memo[r - p2] = NULL;
+        }
     }
+
+    BlocDeBlocs resultat = memo[q];
+    memo[q] = NULL;
+    for (int r = 0; r < q; r++) LibererBlocDeBlocs(memo[r]);
+    free(memo);
     return resultat; 
 }
 
+// -------------------- PPQ en flux : une solution à la fois --------------------
+
+/*
+ * Le nombre de solutions est exponentiel en q : au lieu de les stocker toutes,
+ * PPQ_flux remet chaque solution à une fonction de traitement dès qu'elle est
+ * construite. Un seul tableau préfixe est réutilisé (retour sur trace) :
+ * aucune allocation par solution et une mémoire totale en O(q).
+ */
+typedef void (*TraiterSolution)(const int *solution, int longueur, void *ctx);
+
+/*
+ * @brief Complète le préfixe de toutes les façons possibles d'atteindre q_restant
+ * @param prefixe Valeurs déjà choisies
+ * @param longueur Nombre de valeurs du préfixe
+ * Complexité : O(nombre de solutions * q / p1)
+ */
+void PPQ_fluxRec(int p1, int p2, int q_restant, int *prefixe, int longueur,
+                 TraiterSolution traiter, void *ctx){
+    if (q_restant == 0){
+        traiter(prefixe, longueur, ctx);
+        return;
+    }
+    for (int i = p1; i <= p2 && i <= q_restant; i++){
+        prefixe[longueur] = i;
+        PPQ_fluxRec(p1, p2, q_restant - i, prefixe, longueur + 1, traiter, ctx);
+    }
+}
+
+/*
+ * @brief Énumère les listes d'entiers de [p1, p2] dont la somme vaut q,
+ *        dans le même ordre que PPQ, sans les mémoriser
+ * @param p1 Borne inférieure (p1 >= 1)
+ * @param p2 Borne supérieure
+ * @param q Somme cible
+ * @param traiter Fonction appelée sur chaque solution (le tableau est réutilisé)
+ * @param ctx Contexte transmis à traiter
+ * Complexité : Exponentielle en temps, O(q) en mémoire
+ */
+void PPQ_flux(int p1, int p2, int q, TraiterSolution traiter, void *ctx){
+    if (p1 < 1 || q < 0) return;
+    int *prefixe = (int *)malloc((q / p1 + 1) * sizeof(int));
+    if (prefixe == NULL) {
+        perror("Erreur d'allocation dans PPQ_flux");
+        exit(EXIT_FAILURE);
+    }
+    PPQ_fluxRec(p1, p2, q, prefixe, 0, traiter, ctx);
+    free(prefixe);
+}
+
+// -------------------- Comptage, rang et accès direct --------------------
+
+/*
+ * nb[r] = nombre de solutions de somme r = somme des nb[r - i] pour p1 <= i <= p2.
+ * Les solutions de somme r commençant par i occupent, dans l'ordre de PPQ,
+ * un bloc contigu de nb[r - i] rangs : on peut donc calculer directement la
+ * k-ième solution ou le rang d'une solution sans rien énumérer.
+ * Les comptes sont des entiers de 128 bits ; au-delà de 2^128 - 1 ils sont
+ * saturés et le champ sature l'indique.
+ */
+typedef unsigned __int128 Compte;
+#define COMPTE_MAX (~(Compte)0)
+
+typedef struct {
+    int p1, p2, q;
+    Compte *nb;      // nb[r] pour r = 0..q
+    bool sature;     // au moins un compte a dépassé COMPTE_MAX
+} TablePPQ;
+
+/*
+ * @brief Calcule le nombre de solutions de chaque somme r <= q
+ * @param p1 Borne inférieure (p1 >= 1 ; sinon, comme pour PPQ, aucune somme
+ *           r > 0 n'a de solution)
+ * @param p2 Borne supérieure
+ * @param q Somme cible maximale
+ * @return TablePPQ La table (à libérer avec LibererTablePPQ)
+ * Complexité : O((p2-p1+1) * q)
+ */
+TablePPQ CreerTablePPQ(int p1, int p2, int q){
+    TablePPQ T = {p1, p2, q, NULL, false};
+    if (q < 0) q = T.q = 0;
+    T.nb = (Compte *)malloc((q + 1) * sizeof(Compte));
+    if (T.nb == NULL) {
+        perror("Erreur d'allocation dans CreerTablePPQ");
+        exit(EXIT_FAILURE);
+    }
+    T.nb[0] = 1;
+    for (int r = 1; r <= q; r++){
+        Compte total = 0;
+        for (int i = p1; p1 >= 1 && i <= p2 && i <= r; i++){
+            if (total > COMPTE_MAX - T.nb[r - i]){
+                total = COMPTE_MAX;
+                T.sature = true;
+            } else {
+                total += T.nb[r - i];
+            }
+        }
+        T.nb[r] = total;
+    }
+    return T;
+}
+
+void LibererTablePPQ(TablePPQ *T){
+    free(T->nb);
+    T->nb = NULL;
+}
+
+/*
+ * @brief Nombre de solutions de PPQ(p1, p2, q) sans les énumérer
+ * Complexité : O((p2-p1+1) * q) en temps, O(q) en mémoire
+ */
+Compte PPQ_compter(int p1, int p2, int q){
+    if (q < 0) return 0;
+    TablePPQ T = CreerTablePPQ(p1, p2, q);
+    Compte nb = T.nb[q];
+    LibererTablePPQ(&T);
+    return nb;
+}
+
+/*
+ * @brief Construit la k-ième solution (k à partir de 0) de somme T->q,
+ *        dans l'ordre d'énumération de PPQ
+ * @param T La table des comptes
+ * @param k Le rang voulu
+ * @param solution Tableau d'au moins q / p1 cases
+ * @return int La longueur de la solution, -1 si k >= nombre de solutions ou
+ *         si la table est saturée (les comptes ne sont plus exacts)
+ * Complexité : O(q / p1 * (p2 - p1 + 1))
+ */
+int PPQ_solutionDeRang(const TablePPQ *T, Compte k, int *solution){
+    if (T->p1 < 1 || T->sature || k >= T->nb[T->q]) return -1;
+    int longueur = 0;
+    int r = T->q;
+    while (r > 0){
+        int i = T->p1;
+        // Saute les blocs de solutions qui commencent par une valeur plus petite
+        while (i <= r && i <= T->p2 && k >= T->nb[r - i]){
+            k -= T->nb[r - i];
+            i++;
+        }
+        if (i > r || i > T->p2) return -1;
+        solution[longueur++] = i;
+        r -= i;
+    }
+    return longueur;
+}
+
+/*
+ * @brief Rang (à partir de 0) d'une solution dans l'ordre de PPQ
+ * @param T La table des comptes (T->q >= somme de la solution)
+ * @param solution Les valeurs de la solution
+ * @param longueur Sa longueur
+ * @return Compte Le rang parmi les solutions de même somme, COMPTE_MAX si
+ *         invalide ou si la table est saturée
+ * Complexité : O(longueur * (p2 - p1 + 1))
+ */
+Compte PPQ_rang(const TablePPQ *T, const int *solution, int longueur){
+    if (T->p1 < 1 || T->sature) return COMPTE_MAX;
+    int r = 0;
+    for (int j = 0; j < longueur; j++){
+        if (solution[j] < T->p1 || solution[j] > T->p2) return COMPTE_MAX;
+        r += solution[j];
+    }
+    if (r > T->q) return COMPTE_MAX;
+
+    Compte rang = 0;
+    for (int j = 0; j < longueur; j++){
+        for (int i = T->p1; i < solution[j]; i++) rang += T->nb[r - i];
+        r -= solution[j];
+    }
+    return rang;
+}
+
+// Écrit un Compte en décimal dans texte (au moins 40 caractères)
+void CompteEnTexte(Compte c, char *texte){
+    char chiffres[40];
+    int n = 0;
+    do {
+        chiffres[n++] = (char)('0' + (int)(c % 10));
+        c /= 10;
+    } while (c != 0);
+    for (int i = 0; i < n; i++) texte[i] = chiffres[n - 1 - i];
+    texte[n] = '\0';
+}
+
+// -------------------- Partitions contraintes --------------------
+
+/*
+ * PPQ_LIBRE      : toute suite de valeurs de [p1, p2] (comportement de PPQ)
+ * PPQ_CROISSANT  : suites croissantes au sens large (chaque multiensemble une fois)
+ * PPQ_STRICT     : suites strictement croissantes (valeurs distinctes)
+ * La longueur peut de plus être bornée par [longueur_min, longueur_max]
+ * (longueur_max < 0 : pas de borne supérieure).
+ */
+typedef enum { PPQ_LIBRE, PPQ_CROISSANT, PPQ_STRICT } ModePPQ;
+
+typedef struct {
+    ModePPQ mode;
+    int longueur_min;
+    int longueur_max;
+} ContraintesPPQ;
+
+typedef struct {
+    int p2;
+    ModePPQ mode;
+    TraiterSolution traiter;
+    void *ctx;
+    int *prefixe;
+} EnumerationContrainte;
+
+/*
+ * @brief Indique si la somme r peut être atteinte avec k valeurs, k dans
+ *        [kmin, kmax], toutes dans [bas, p2] et respectant le mode.
+ *        Avec k valeurs, toutes les sommes entre la plus petite et la plus
+ *        grande possibles sont atteignables :
+ *          - libre ou croissant : [k*bas, k*p2]
+ *          - strict : [k*bas + k(k-1)/2, k*p2 - k(k-1)/2], avec k <= p2 - bas + 1
+ * @return true si au moins une longueur convient
+ * Complexité : O(1) (libre, croissant), O(sqrt(r)) (strict)
+ */
+bool Realisable(ModePPQ mode, int bas, int p2, int r, int kmin, int kmax){
+    if (kmin < 0) kmin = 0;
+    if (r == 0) return kmin == 0;
+    if (bas > p2 || bas > r || kmax == 0) return false;
+    if (mode != PPQ_STRICT){
+        long long kbas = (r + p2 - 1) / p2;              // au moins ceil(r / p2) valeurs
+        long long khaut = r / bas;                       // au plus floor(r / bas) valeurs
+        if (kbas < kmin) kbas = kmin;
+        if (kmax >= 0 && khaut > kmax) khaut = kmax;
+        return kbas <= khaut;
+    }
+    long long kplafond = p2 - bas + 1;
+    if (kmax >= 0 && kplafond > kmax) kplafond = kmax;
+    for (long long k = (kmin > 1 ? kmin : 1); k <= kplafond; k++){
+        long long triangle = k * (k - 1) / 2;
+        if (k * bas + triangle > r) return false;        // la somme minimale ne fait que croître
+        if (k * p2 - triangle >= r) return true;
+    }
+    return false;
+}
+
+/*
+ * @brief Retour sur trace avec élagage : une valeur n'est essayée que si le
+ *        reste est encore réalisable avec les longueurs autorisées
+ * @param bas Plus petite valeur autorisée pour la position courante
+ * @param kmin, kmax Nombre de valeurs restant à placer (kmax < 0 : illimité)
+ * Complexité : O(nombre de solutions * q / p1 * coût de Realisable)
+ */
+void PPQ_contraintRec(EnumerationContrainte *E, int bas, int q_restant, int longueur, int kmin, int kmax){
+    if (q_restant == 0){
+        E->traiter(E->prefixe, longueur, E->ctx);
+        return;
+    }
+    for (int i = bas; i <= E->p2 && i <= q_restant; i++){
+        int prochain_bas = (E->mode == PPQ_LIBRE) ? bas : (E->mode == PPQ_CROISSANT ? i : i + 1);
+        int nkmax = (kmax < 0) ? -1 : kmax - 1;
+        if (!Realisable(E->mode, prochain_bas, E->p2, q_restant - i, kmin - 1, nkmax)) continue;
+        E->prefixe[longueur] = i;
+        PPQ_contraintRec(E, prochain_bas, q_restant - i, longueur + 1, kmin - 1, nkmax);
+    }
+}
+
+/*
+ * @brief Énumère en flux les solutions de PPQ respectant les contraintes,
+ *        dans l'ordre de PPQ
+ * @param p1 Borne inférieure (p1 >= 1)
+ * @param p2 Borne supérieure
+ * @param q Somme cible
+ * @param C Les contraintes
+ * @param traiter Fonction appelée sur chaque solution
+ * @param ctx Contexte transmis à traiter
+ * Complexité : proportionnelle au nombre de solutions (les branches stériles sont coupées)
+ */
+void PPQ_fluxContraint(int p1, int p2, int q, const ContraintesPPQ *C, TraiterSolution traiter, void *ctx){
+    if (p1 < 1 || q < 0) return;
+    if (!Realisable(C->mode, p1, p2, q, C->longueur_min, C->longueur_max)) return;
+    EnumerationContrainte E = {p2, C->mode, traiter, ctx, NULL};
+    E.prefixe = (int *)malloc((q / p1 + 1) * sizeof(int));
+    if (E.prefixe == NULL) {
+        perror("Erreur d'allocation dans PPQ_fluxContraint");
+        exit(EXIT_FAILURE);
+    }
+    PPQ_contraintRec(&E, p1, q, 0, C->longueur_min, C->longueur_max);
+    free(E.prefixe);
+}
+
+// Addition avec saturation à COMPTE_MAX
+static inline Compte AjouterCompte(Compte a, Compte b){
+    return (a > COMPTE_MAX - b) ? COMPTE_MAX : a + b;
+}
+
+/*
+ * @brief Compte les solutions respectant les contraintes sans les énumérer.
+ *        c[k][r] = nombre de suites de k valeurs de somme r ; selon le mode,
+ *        chaque valeur v de [p1, p2] est ajoutée :
+ *          - libre : en toute position   c[k][r] = somme des c[k-1][r-v]
+ *          - croissant : autant de fois que voulu (sac à dos non borné)
+ *          - strict : au plus une fois (sac à dos 0/1, k décroissant)
+ * @return Compte Le nombre de solutions (saturé à COMPTE_MAX)
+ * Complexité : O((p2-p1+1) * q * K) où K = min(longueur_max, q / p1)
+ */
+Compte PPQ_compterContraint(int p1, int p2, int q, const ContraintesPPQ *C){
+    if (p1 < 1 || q < 0) return 0;
+    int K = q / p1;
+    if (C->longueur_max >= 0 && C->longueur_max < K) K = C->longueur_max;
+    int kmin = (C->longueur_min > 0) ? C->longueur_min : 0;
+    if (kmin > K) return 0;
+
+    Compte *c = (Compte *)calloc((size_t)(K + 1) * (q + 1), sizeof(Compte));
+    if (c == NULL) {
+        perror("Erreur d'allocation dans PPQ_compterContraint");
+        exit(EXIT_FAILURE);
+    }
+#define C_(k, r) c[(size_t)(k) * (q + 1) + (r)]
+    C_(0, 0) = 1;
+    if (C->mode == PPQ_LIBRE){
+        for (int k = 1; k <= K; k++)
+            for (int r = 1; r <= q; r++)
+                for (int v = p1; v <= p2 && v <= r; v++)
+                    C_(k, r) = AjouterCompte(C_(k, r), C_(k - 1, r - v));
+    } else {
+        for (int v = p1; v <= p2 && v <= q; v++){
+            for (int t = 1; t <= K; t++){
+                int k = (C->mode == PPQ_CROISSANT) ? t : K + 1 - t;
+                for (int r = v; r <= q; r++)
+                    C_(k, r) = AjouterCompte(C_(k, r), C_(k - 1, r - v));
+            }
+        }
+    }
+    Compte total = 0;
+    for (int k = kmin; k <= K; k++) total = AjouterCompte(total, C_(k, q));
+#undef C_
+    free(c);
+    return total;
+}
+
 // -------------------- Affichage --------------------
 void AfficherBloc(Bloc B){
     printf("[");
@@ -163,6 +528,24 @@ void AfficherBloc(Bloc B){
     printf("]");
 }
 
+// Fonction de traitement pour PPQ_flux : affiche la solution comme AfficherBloc
+void AfficherSolution(const int *solution, int longueur, void *ctx){
+    (void)ctx;
+    printf("[");
+    for (int i = 0; i < longueur; i++){
+        printf("%d", solution[i]);
+        if (i + 1 < longueur) printf(", ");
+    }
+    printf("] ");
+}
+
+// Fonction de traitement pour PPQ_flux : compte les solutions
+void CompterSolution(const int *solution, int longueur, void *ctx){
+    (void)solution;
+    (void)longueur;
+    (*(long long *)ctx)++;
+}
+
 void AfficherBlocDeBlocs(BlocDeBlocs BB){
     while (BB != NULL){
         AfficherBloc(BB->solution);
@@ -183,5 +566,56 @@ int main() {
 
     LibererBlocDeBlocs(resultat);
 
+    printf("Mêmes solutions en flux :\n");
+    PPQ_flux(p1, p2, q, AfficherSolution, NULL);
+    printf("\n");
+
+    // Instance trop grande pour être stockée : les solutions sont seulement comptées
+    long long nb = 0;
+    PPQ_flux(1, 3, 30, CompterSolution, &nb);
+    printf("Nombre de solutions pour p1=1, p2=3, q=30 : %lld\n", nb);
+
+    // Comptage direct et accès à la k-ième solution
+    char texte[41];
+    TablePPQ T = CreerTablePPQ(p1, p2, q);
+    CompteEnTexte(T.nb[q], texte);
+    printf("Comptage direct pour p1=%d, p2=%d, q=%d : %s\n", p1, p2, q, texte);
+    int solution[100];   // q / p1 cases suffisent pour toutes les instances ci-dessous
+    for (Compte k = 0; k < T.nb[q]; k += 5){
+        int longueur = PPQ_solutionDeRang(&T, k, solution);
+        CompteEnTexte(PPQ_rang(&T, solution, longueur), texte);
+        printf("Solution de rang %d : ", (int)k);
+        AfficherSolution(solution, longueur, NULL);
+        printf("(rang recalculé : %s)\n", texte);
+    }
+    LibererTablePPQ(&T);
+
+    T = CreerTablePPQ(1, 3, 100);
+    CompteEnTexte(T.nb[100], texte);
+    printf("Nombre de solutions pour p1=1, p2=3, q=100 : %s%s\n", texte, T.sature ? " (saturé)" : "");
+    Compte milieu = T.nb[100] / 2;
+    int longueur = PPQ_solutionDeRang(&T, milieu, solution);
+    printf("Solution du milieu : ");
+    AfficherSolution(solution, longueur, NULL);
+    printf("\n");
+    LibererTablePPQ(&T);
+
+    // Variantes contraintes
+    const char *noms[] = {"libres", "croissantes", "strictement croissantes"};
+    for (int m = PPQ_LIBRE; m <= PPQ_STRICT; m++){
+        ContraintesPPQ C = {(ModePPQ)m, 0, -1};
+        printf("Solutions %s pour p1=1, p2=6, q=8 :\n", noms[m]);
+        if (m != PPQ_LIBRE) PPQ_fluxContraint(1, 6, 8, &C, AfficherSolution, NULL);
+        CompteEnTexte(PPQ_compterContraint(1, 6, 8, &C), texte);
+        printf("%s(%s solutions)\n", m != PPQ_LIBRE ? "\n" : "", texte);
+    }
+    ContraintesPPQ C = {PPQ_CROISSANT, 3, 4};
+    printf("Solutions croissantes de 3 ou 4 valeurs pour p1=1, p2=6, q=8 :\n");
+    PPQ_fluxContraint(1, 6, 8, &C, AfficherSolution, NULL);
+    printf("\n");
+    C = (ContraintesPPQ){PPQ_STRICT, 0, -1};
+    CompteEnTexte(PPQ_compterContraint(1, 200, 200, &C), texte);
+    printf("Partitions de 200 en parts distinctes : %s\n", texte);
+
     return 0;
 }
@@ -0,0 +1,362 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/*
+ * PPQ compact - Résultats au format CSR et fichier binaire
+ *
+ * Le résultat de PPQ est une liste de listes (BlocDeBlocs de Bloc) : deux
+ * pointeurs et un malloc par entier. Ici toutes les solutions sont rangées
+ * dans un seul tableau de valeurs, et un tableau de débuts donne la position
+ * de chaque solution (format CSR) :
+ *     solution i = valeurs[debuts[i] .. debuts[i+1] - 1]
+ * Les valeurs sont stockées sur 1 ou 2 octets quand p2 le permet.
+ *
+ * Le fichier binaire reprend exactement cette disposition (en-tête, débuts,
+ * valeurs) : ChargerCSR le projette en mémoire avec mmap, sans analyse.
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+#define MAGIE_CSR "PPQCSR1"
+
+// -------------------- Structures --------------------
+
+// En-tête du fichier binaire (ordre des octets de la machine)
+typedef struct {
+    char magie[8];
+    int32_t p1, p2, q;
+    uint32_t taille_element;   // 1, 2 ou 4 octets par valeur
+    uint64_t nb_solutions;
+    uint64_t nb_valeurs;
+} EnteteCSR;
+
+typedef struct {
+    int p1, p2, q;
+    unsigned taille_element;
+    uint64_t nb_solutions;
+    uint64_t nb_valeurs;
+    uint64_t *debuts;          // nb_solutions + 1 positions
+    void *valeurs;             // nb_valeurs éléments de taille_element octets
+    void *projection;          // zone mmap si le résultat vient d'un fichier, NULL sinon
+    size_t taille_projection;
+} ResultatCSR;
+
+// -------------------- Accès --------------------
+
+// Nombre d'octets suffisant pour stocker toute valeur de [p1, p2]
+// Complexité : O(1)
+unsigned tailleElementPour(int p2){
+    if (p2 <= UINT8_MAX) return 1;
+    if (p2 <= UINT16_MAX) return 2;
+    return 4;
+}
+
+// j-ième valeur du tableau de valeurs
+// Complexité : O(1)
+static inline int lireValeur(const ResultatCSR *R, uint64_t j){
+    switch (R->taille_element){
+        case 1: return ((const uint8_t *)R->valeurs)[j];
+        case 2: return ((const uint16_t *)R->valeurs)[j];
+        default: return ((const int32_t *)R->valeurs)[j];
+    }
+}
+
+static inline void ecrireValeur(ResultatCSR *R, uint64_t j, int v){
+    switch (R->taille_element){
+        case 1: ((uint8_t *)R->valeurs)[j] = (uint8_t)v; break;
+        case 2: ((uint16_t *)R->valeurs)[j] = (uint16_t)v; break;
+        default: ((int32_t *)R->valeurs)[j] = v; break;
+    }
+}
+
+// Longueur de la solution i
+// Complexité : O(1)
+uint64_t longueurSolution(const ResultatCSR *R, uint64_t i){
+    return R->debuts[i + 1] - R->debuts[i];
+}
+
+// k-ième valeur de la solution i
+// Complexité : O(1)
+int valeurSolution(const ResultatCSR *R, uint64_t i, uint64_t k){
+    return lireValeur(R, R->debuts[i] + k);
+}
+
+// -------------------- Construction --------------------
+
+// Addition sans débordement : en cas de dépassement, *deborde passe à 1
+static inline uint64_t ajouterVerifie(uint64_t a, uint64_t b, int *deborde){
+    if (a > UINT64_MAX - b){
+        *deborde = 1;
+        return UINT64_MAX;
+    }
+    return a + b;
+}
+
+typedef struct {
+    ResultatCSR *R;
+    int *prefixe;
+    uint64_t solution;         // indice de la prochaine solution
+    uint64_t position;         // prochaine case libre de valeurs
+} Remplissage;
+
+// Retour sur trace de PPQ_flux, chaque solution est recopiée à sa place
+// Complexité : O(nombre de valeurs écrites * (p2 - p1 + 1))
+void remplirCSR(Remplissage *E, int q_restant, int longueur){
+    ResultatCSR *R = E->R;
+    if (q_restant == 0){
+        for (int k = 0; k < longueur; k++) ecrireValeur(R, E->position++, E->prefixe[k]);
+        R->debuts[++E->solution] = E->position;
+        return;
+    }
+    for (int i = R->p1; i <= R->p2 && i <= q_restant; i++){
+        E->prefixe[longueur] = i;
+        remplirCSR(E, q_restant - i, longueur + 1);
+    }
+}
+
+/*
+ * @brief Construit toutes les solutions de PPQ(p1, p2, q) au format CSR.
+ *        Le nombre de solutions et de valeurs est d'abord calculé par
+ *        programmation dynamique : les tableaux sont alloués une seule fois.
+ * @param p1 Borne inférieure (p1 >= 1)
+ * @param p2 Borne supérieure
+ * @param q Somme cible
+ * @return ResultatCSR Le résultat (à libérer avec LibererCSR) ; le programme
+ *         s'arrête si le nombre de solutions ou de valeurs ne tient pas en mémoire
+ * Complexité : O((p2-p1+1) * q + V) où V = nombre total de valeurs
+ */
+ResultatCSR PPQ_CSR(int p1, int p2, int q){
+    ResultatCSR R;
+    memset(&R, 0, sizeof(R));
+    R.p1 = p1;
+    R.p2 = p2;
+    R.q = q;
+    R.taille_element = tailleElementPour(p2);
+    if (p1 < 1 || q < 0) q = -1;
+
+    // nb[r] = nombre de solutions de somme r, lg[r] = somme de leurs longueurs
+    uint64_t *nb = (uint64_t *)calloc(q + 2, sizeof(uint64_t));
+    uint64_t *lg = (uint64_t *)calloc(q + 2, sizeof(uint64_t));
+    if (nb == NULL || lg == NULL){
+        perror("Erreur d'allocation dans PPQ_CSR");
+        exit(EXIT_FAILURE);
+    }
+    if (q >= 0) nb[0] = 1;
+    int deborde = 0;
+    for (int r = 1; r <= q; r++){
+        for (int i = p1; i <= p2 && i <= r; i++){
+            nb[r] = ajouterVerifie(nb[r], nb[r - i], &deborde);
+            lg[r] = ajouterVerifie(lg[r], ajouterVerifie(lg[r - i], nb[r - i], &deborde), &deborde);
+        }
+    }
+    R.nb_solutions = (q >= 0) ? nb[q] : 0;
+    R.nb_valeurs = (q >= 0) ? lg[q] : 0;
+    free(nb);
+    free(lg);
+
+    // Les deux tableaux doivent pouvoir être alloués sans que leur taille déborde
+    if (deborde || R.nb_solutions >= SIZE_MAX / sizeof(uint64_t) ||
+        R.nb_valeurs >= (SIZE_MAX - 1) / R.taille_element){
+        fprintf(stderr, "PPQ_CSR : trop de solutions pour p1=%d, p2=%d, q=%d\n", p1, p2, q);
+        exit(EXIT_FAILURE);
+    }
+
+    R.debuts = (uint64_t *)malloc((R.nb_solutions + 1) * sizeof(uint64_t));
+    R.valeurs = malloc(R.nb_valeurs * R.taille_element + 1);
+    int *prefixe = (int *)malloc(((q > 0 ? q : 0) / (p1 > 0 ? p1 : 1) + 1) * sizeof(int));
+    if (R.debuts == NULL || R.valeurs == NULL || prefixe == NULL){
+        perror("Erreur d'allocation dans PPQ_CSR");
+        exit(EXIT_FAILURE);
+    }
+    R.debuts[0] = 0;
+    if (q >= 0){
+        Remplissage E = {&R, prefixe, 0, 0};
+        remplirCSR(&E, q, 0);
+    }
+    free(prefixe);
+    return R;
+}
+
+/*
+ * @brief Libère un résultat construit par PPQ_CSR ou projeté par ChargerCSR
+ * @param R Le résultat
+ * Complexité : O(1)
+ */
+void LibererCSR(ResultatCSR *R){
+    if (R->projection != NULL){
+        munmap(R->projection, R->taille_projection);
+    } else {
+        free(R->debuts);
+        free(R->valeurs);
+    }
+    memset(R, 0, sizeof(*R));
+}
+
+// -------------------- Fichier binaire --------------------
+
+// Arrondit au multiple de 8 supérieur (alignement des sections du fichier)
+static inline uint64_t aligner8(uint64_t x){
+    return (x + 7) & ~(uint64_t)7;
+}
+
+/*
+ * @brief Écrit le résultat dans un fichier : en-tête, débuts, valeurs
+ * @param R Le résultat
+ * @param chemin Chemin du fichier
+ * @return int 0 en cas de succès, -1 sinon
+ * Complexité : O(nb_solutions + nb_valeurs)
+ */
+int EcrireCSR(const ResultatCSR *R, const char *chemin){
+    FILE *f = fopen(chemin, "wb");
+    if (f == NULL){
+        perror("Erreur d'ouverture dans EcrireCSR");
+        return -1;
+    }
+    EnteteCSR E;
+    memset(&E, 0, sizeof(E));
+    memcpy(E.magie, MAGIE_CSR, sizeof(E.magie));
+    E.p1 = R->p1;
+    E.p2 = R->p2;
+    E.q = R->q;
+    E.taille_element = R->taille_element;
+    E.nb_solutions = R->nb_solutions;
+    E.nb_valeurs = R->nb_valeurs;
+
+    uint64_t octets_valeurs = R->nb_valeurs * R->taille_element;
+    static const char zeros[8] = {0};
+    int ok = fwrite(&E, sizeof(E), 1, f) == 1
+          && fwrite(R->debuts, sizeof(uint64_t), R->nb_solutions + 1, f) == R->nb_solutions + 1
+          && fwrite(R->valeurs, 1, octets_valeurs, f) == octets_valeurs
+          && fwrite(zeros, 1, aligner8(octets_valeurs) - octets_valeurs, f) == aligner8(octets_valeurs) - octets_valeurs;
+    if (fclose(f) != 0) ok = 0;
+    if (!ok){
+        perror("Erreur d'écriture dans EcrireCSR");
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * @brief Projette un fichier écrit par EcrireCSR en mémoire (lecture seule) ;
+ *        les tableaux pointent directement dans la projection
+ * @param chemin Chemin du fichier
+ * @param R Résultat rempli en cas de succès
+ * @return int 0 en cas de succès, -1 si le fichier est absent ou invalide
+ * Complexité : O(nb_solutions) pour vérifier le tableau des débuts (les
+ *              valeurs sont chargées à la demande)
+ */
+int ChargerCSR(const char *chemin, ResultatCSR *R){
+    memset(R, 0, sizeof(*R));
+    int fd = open(chemin, O_RDONLY);
+    if (fd < 0){
+        perror("Erreur d'ouverture dans ChargerCSR");
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(EnteteCSR)){
+        fprintf(stderr, "ChargerCSR : fichier trop court\n");
+        close(fd);
+        return -1;
+    }
+    size_t taille = (size_t)st.st_size;
+    void *projection = mmap(NULL, taille, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (projection == MAP_FAILED){
+        perror("Erreur mmap dans ChargerCSR");
+        return -1;
+    }
+
+    const EnteteCSR *E = (const EnteteCSR *)projection;
+    uint64_t octets_debuts = (E->nb_solutions + 1) * sizeof(uint64_t);
+    uint64_t octets_valeurs = E->nb_valeurs * E->taille_element;
+    int valide = memcmp(E->magie, MAGIE_CSR, sizeof(E->magie)) == 0
+              && (E->taille_element == 1 || E->taille_element == 2 || E->taille_element == 4)
+              && E->nb_solutions < taille / sizeof(uint64_t)
+              && E->nb_valeurs <= taille
+              && sizeof(EnteteCSR) + octets_debuts + aligner8(octets_valeurs) == taille;
+    if (!valide){
+        fprintf(stderr, "ChargerCSR : en-tête invalide\n");
+        munmap(projection, taille);
+        return -1;
+    }
+
+    R->p1 = E->p1;
+    R->p2 = E->p2;
+    R->q = E->q;
+    R->taille_element = E->taille_element;
+    R->nb_solutions = E->nb_solutions;
+    R->nb_valeurs = E->nb_valeurs;
+    R->debuts = (uint64_t *)((char *)projection + sizeof(EnteteCSR));
+    R->valeurs = (char *)projection + sizeof(EnteteCSR) + octets_debuts;
+    R->projection = projection;
+    R->taille_projection = taille;
+    // Chaque tranche debuts[i] .. debuts[i+1] doit être croissante et rester dans valeurs
+    int coherent = R->debuts[0] == 0 && R->debuts[R->nb_solutions] == R->nb_valeurs;
+    for (uint64_t i = 0; coherent && i < R->nb_solutions; i++)
+        coherent = R->debuts[i] <= R->debuts[i + 1];
+    if (!coherent){
+        fprintf(stderr, "ChargerCSR : tableau des débuts incohérent\n");
+        LibererCSR(R);
+        return -1;
+    }
+    return 0;
+}
+
+// -------------------- Affichage --------------------
+void AfficherCSR(const ResultatCSR *R){
+    for (uint64_t i = 0; i < R->nb_solutions; i++){
+        printf("[");
+        for (uint64_t k = 0; k < longueurSolution(R, i); k++){
+            printf("%d", valeurSolution(R, i, k));
+            if (k + 1 < longueurSolution(R, i)) printf(", ");
+        }
+        printf("] ");
+    }
+    printf("\n");
+}
+
+// -------------------- Exemple de main --------------------
+int main(int argc, char *argv[]){
+    const char *chemin = (argc > 1) ? argv[1] : "ppq_csr.bin";
+    int p1 = 2, p2 = 4, q = 9;
+
+    ResultatCSR R = PPQ_CSR(p1, p2, q);
+    printf("Solutions pour p1=%d, p2=%d, q=%d:\n", p1, p2, q);
+    AfficherCSR(&R);
+    LibererCSR(&R);
+
+    // Instance plus grande : écriture puis relecture par projection mémoire
+    q = (argc > 2) ? atoi(argv[2]) : 24;
+    clock_t debut = clock();
+    R = PPQ_CSR(1, 3, q);
+    clock_t fin = clock();
+    size_t octets_csr = (R.nb_solutions + 1) * sizeof(uint64_t) + R.nb_valeurs * R.taille_element;
+    // Liste de listes sans partage : un Bloc par valeur, un BlocDeBlocs par solution
+    size_t octets_listes = R.nb_valeurs * 16 + R.nb_solutions * 16;
+    printf("p1=1, p2=3, q=%d : %llu solutions, %llu valeurs sur %u octet(s) en %.3f s\n", q,
+           (unsigned long long)R.nb_solutions, (unsigned long long)R.nb_valeurs, R.taille_element,
+           (double)(fin - debut) / CLOCKS_PER_SEC);
+    printf("  mémoire CSR %.1f Mo (listes chaînées : au moins %.1f Mo hors en-têtes malloc)\n",
+           octets_csr / 1e6, octets_listes / 1e6);
+
+    if (EcrireCSR(&R, chemin) != 0) return EXIT_FAILURE;
+    ResultatCSR L;
+    if (ChargerCSR(chemin, &L) != 0) return EXIT_FAILURE;
+    int identique = L.nb_solutions == R.nb_solutions && L.nb_valeurs == R.nb_valeurs
+                 && memcmp(L.debuts, R.debuts, (R.nb_solutions + 1) * sizeof(uint64_t)) == 0
+                 && memcmp(L.valeurs, R.valeurs, R.nb_valeurs * R.taille_element) == 0;
+    printf("  relecture par mmap de %s : %s\n", chemin, identique ? "identique" : "différente");
+
+    LibererCSR(&L);
+    LibererCSR(&R);
+    if (argc <= 1) remove(chemin);
+    return 0;
+}
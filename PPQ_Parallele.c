@@ -0,0 +1,576 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+/*
+ * PPQ parallèle - Énumération multi-thread par vol de tâches
+ *
+ * Chaque valeur i choisie en tête d'une solution ouvre un sous-arbre de
+ * recherche indépendant. Ces sous-arbres sont très inégaux (commencer par p1
+ * laisse beaucoup plus de solutions que commencer par p2) : on découpe donc
+ * récursivement, à n'importe quelle profondeur, toute tâche dont le nombre
+ * estimé de solutions dépasse GRAIN.
+ *
+ * Les tâches sont exécutées par un groupe de threads : chacun dépile ses
+ * propres tâches (LIFO) et, quand il n'en a plus, vole la plus ancienne
+ * tâche d'un autre thread (FIFO) ; après TOURS_AVANT_SOMMEIL tentatives
+ * infructueuses, il s'endort jusqu'au prochain dépôt de tâche ou jusqu'à la
+ * fin de l'énumération. Les résultats de chaque tâche sont gardés
+ * à part et un curseur parcourt l'arbre des tâches dans l'ordre : dès que la
+ * tâche sous le curseur est terminée, ses solutions sont émises puis libérées.
+ * La sortie est identique à celle de la version séquentielle, et seules les
+ * tâches terminées en avance sur le curseur occupent de la mémoire. Quand
+ * elles dépassent LIMITE_TAMPON solutions, les threads attendent que
+ * l'émission en cours se termine, puis exécutent d'abord la prochaine tâche
+ * dans l'ordre au lieu des plus lointaines.
+ *
+ * Compilation : gcc -O2 -pthread PPQ_Parallele.c
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+#define GRAIN 20000.0   // nombre estimé de solutions au-delà duquel une tâche est découpée
+#define TOURS_AVANT_SOMMEIL 64   // vols infructueux avant qu'un thread inactif s'endorme
+#define LIMITE_TAMPON (1L << 20)   // solutions en attente d'émission au-delà desquelles on rattrape le curseur
+
+typedef void (*TraiterSolution)(const int *solution, int longueur, void *ctx);
+
+// -------------------- Structures --------------------
+typedef struct Tache {
+    int *prefixe;               // valeurs déjà choisies
+    int longueur;               // longueur du préfixe
+    int q_restant;              // somme qu'il reste à atteindre
+    struct Tache *parent;       // NULL pour la racine
+    int rang;                   // indice dans parent->enfants
+    atomic_bool terminee;       // découpée ou explorée : le curseur d'émission peut y entrer
+    struct Tache **enfants;     // sous-tâches dans l'ordre croissant de la valeur ajoutée
+    int nb_enfants;
+    // Résultats d'une tâche exécutée sans découpage
+    long long compte;           // nombre de solutions trouvées
+    int *valeurs;               // solutions mises bout à bout (si conservées)
+    size_t nb_valeurs, cap_valeurs;
+    int *longueurs;             // longueur de chaque solution
+    size_t nb_solutions, cap_solutions;
+} Tache;
+
+// File à deux bouts d'un thread : le propriétaire travaille en haut, les voleurs prennent en bas
+typedef struct {
+    Tache **taches;
+    size_t bas, haut, capacite;
+    pthread_mutex_t verrou;
+} Deque;
+
+typedef struct {
+    int p1, p2;
+    bool conserver;             // garder les solutions (sinon seulement les compter)
+    double *estimation;         // estimation[r] = nombre de solutions de somme r
+    Deque *deques;
+    int nb_threads;
+    atomic_long en_attente;     // tâches créées et pas encore terminées
+    atomic_long deposees;       // tâches en attente dans les deques
+    // Threads inactifs endormis
+    pthread_mutex_t sommeil;
+    pthread_cond_t travail_dispo;   // une tâche a été déposée ou tout est terminé
+    atomic_int endormis;
+    // Émission dans l'ordre, au fil de l'eau
+    TraiterSolution traiter;
+    void *ctx;
+    pthread_mutex_t emission;   // protège emetteur_actif et a_emettre
+    pthread_cond_t emission_finie;
+    bool emetteur_actif;        // un thread fait avancer le curseur (lui seul y touche)
+    bool a_emettre;             // une tâche s'est terminée pendant son passage
+    atomic_long en_tampon;      // solutions mémorisées et pas encore émises
+    Tache *curseur;             // prochaine tâche à émettre (NULL : tout est émis)
+    long long total;            // solutions déjà émises
+} Groupe;
+
+typedef struct {
+    Groupe *G;
+    int numero;
+} Ouvrier;
+
+// -------------------- Outils --------------------
+void *allouer(size_t octets){
+    void *p = malloc(octets);
+    if (p == NULL){
+        perror("Erreur d'allocation");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+Tache *creerTache(const int *prefixe, int longueur, int valeur, int q_restant){
+    Tache *T = (Tache *)calloc(1, sizeof(Tache));
+    if (T == NULL){
+        perror("Erreur d'allocation dans creerTache");
+        exit(EXIT_FAILURE);
+    }
+    T->prefixe = (int *)allouer((longueur + 1) * sizeof(int));
+    if (longueur > 0) memcpy(T->prefixe, prefixe, (longueur - 1) * sizeof(int));
+    if (longueur > 0) T->prefixe[longueur - 1] = valeur;
+    T->longueur = longueur;
+    T->q_restant = q_restant;
+    atomic_init(&T->terminee, false);
+    return T;
+}
+
+void libererTache(Tache *T){
+    for (int i = 0; i < T->nb_enfants; i++) libererTache(T->enfants[i]);
+    free(T->enfants);
+    free(T->prefixe);
+    free(T->valeurs);
+    free(T->longueurs);
+    free(T);
+}
+
+// -------------------- Deque de tâches --------------------
+
+// Complexité : O(1) amorti
+void deposer(Deque *D, Tache *T){
+    pthread_mutex_lock(&D->verrou);
+    if (D->haut == D->capacite){
+        if (D->bas > 0){
+            // Place libérée par les vols : on recale les tâches au début
+            memmove(D->taches, D->taches + D->bas, (D->haut - D->bas) * sizeof(Tache *));
+            D->haut -= D->bas;
+            D->bas = 0;
+        } else {
+            D->capacite = (D->capacite == 0) ? 64 : 2 * D->capacite;
+            Tache **taches = (Tache **)realloc(D->taches, D->capacite * sizeof(Tache *));
+            if (taches == NULL){
+                perror("Erreur d'allocation dans deposer");
+                exit(EXIT_FAILURE);
+            }
+            D->taches = taches;
+        }
+    }
+    D->taches[D->haut++] = T;
+    pthread_mutex_unlock(&D->verrou);
+}
+
+// Tâche la plus récente (propriétaire) ; NULL si vide
+// Complexité : O(1)
+Tache *reprendre(Deque *D){
+    Tache *T = NULL;
+    pthread_mutex_lock(&D->verrou);
+    if (D->haut > D->bas) T = D->taches[--D->haut];
+    if (D->haut == D->bas) D->haut = D->bas = 0;
+    pthread_mutex_unlock(&D->verrou);
+    return T;
+}
+
+// Tâche la plus ancienne (voleur) : c'est en général la plus grosse
+// Complexité : O(1)
+Tache *voler(Deque *D){
+    Tache *T = NULL;
+    pthread_mutex_lock(&D->verrou);
+    if (D->haut > D->bas) T = D->taches[D->bas++];
+    if (D->haut == D->bas) D->haut = D->bas = 0;
+    pthread_mutex_unlock(&D->verrou);
+    return T;
+}
+
+/*
+ * @brief Vrai si la tâche A vient avant B dans l'ordre séquentiel : ordre
+ *        lexicographique des préfixes (deux tâches en attente ne sont jamais
+ *        préfixe l'une de l'autre, leur ancêtre commun a déjà été découpé)
+ * Complexité : O(longueur des préfixes)
+ */
+bool avant(const Tache *A, const Tache *B){
+    int n = (A->longueur < B->longueur) ? A->longueur : B->longueur;
+    for (int i = 0; i < n; i++){
+        if (A->prefixe[i] != B->prefixe[i]) return A->prefixe[i] < B->prefixe[i];
+    }
+    return A->longueur < B->longueur;
+}
+
+/*
+ * @brief Prend, parmi les sommets des deques, la tâche qui vient en premier
+ *        dans l'ordre séquentiel : c'est elle qui bloque le curseur d'émission
+ * @param G Le groupe
+ * @return Tache* La tâche (NULL si toutes les deques sont vides)
+ * Complexité : O(nb_threads * longueur des préfixes)
+ */
+Tache *prendrePremiere(Groupe *G){
+    Tache *P = NULL;
+    int choisie = -1;
+    for (int t = 0; t < G->nb_threads; t++){
+        Deque *D = &G->deques[t];
+        pthread_mutex_lock(&D->verrou);
+        if (D->haut > D->bas && (P == NULL || avant(D->taches[D->haut - 1], P))){
+            P = D->taches[D->haut - 1];
+            choisie = t;
+        }
+        pthread_mutex_unlock(&D->verrou);
+    }
+    // Le sommet a pu changer entre-temps : on prend le sommet actuel de cette deque
+    return (choisie < 0) ? NULL : reprendre(&G->deques[choisie]);
+}
+
+// -------------------- Sommeil des threads inactifs --------------------
+
+/*
+ * @brief Endort un thread inactif jusqu'à ce qu'une tâche soit déposée ou
+ *        que toutes les tâches soient terminées
+ * @param G Le groupe
+ * Complexité : O(1) hors attente
+ */
+void attendreTravail(Groupe *G){
+    pthread_mutex_lock(&G->sommeil);
+    atomic_fetch_add(&G->endormis, 1);
+    // endormis est incrémenté avant de relire deposees, et le déposant fait
+    // l'inverse : l'un des deux voit toujours l'autre
+    while (atomic_load(&G->deposees) == 0 && atomic_load(&G->en_attente) > 0){
+        pthread_cond_wait(&G->travail_dispo, &G->sommeil);
+    }
+    atomic_fetch_sub(&G->endormis, 1);
+    pthread_mutex_unlock(&G->sommeil);
+}
+
+// Réveille les threads endormis après un dépôt (rien à faire si aucun ne dort)
+// Complexité : O(1)
+void signalerDepot(Groupe *G){
+    if (atomic_load(&G->endormis) == 0) return;
+    pthread_mutex_lock(&G->sommeil);
+    pthread_cond_broadcast(&G->travail_dispo);
+    pthread_mutex_unlock(&G->sommeil);
+}
+
+// -------------------- Exécution d'une tâche --------------------
+
+// Ajoute la solution courante aux résultats de la tâche
+// Complexité : O(longueur) amorti
+void memoriserSolution(Tache *T, const int *solution, int longueur){
+    if (T->nb_valeurs + longueur > T->cap_valeurs){
+        T->cap_valeurs = 2 * (T->nb_valeurs + longueur);
+        T->valeurs = (int *)realloc(T->valeurs, T->cap_valeurs * sizeof(int));
+        if (T->valeurs == NULL){
+            perror("Erreur d'allocation dans memoriserSolution");
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (T->nb_solutions == T->cap_solutions){
+        T->cap_solutions = (T->cap_solutions == 0) ? 64 : 2 * T->cap_solutions;
+        T->longueurs = (int *)realloc(T->longueurs, T->cap_solutions * sizeof(int));
+    }
+    if (T->longueurs == NULL){
+        perror("Erreur d'allocation dans memoriserSolution");
+        exit(EXIT_FAILURE);
+    }
+    if (longueur > 0) memcpy(T->valeurs + T->nb_valeurs, solution, longueur * sizeof(int));
+    T->nb_valeurs += longueur;
+    T->longueurs[T->nb_solutions++] = longueur;
+}
+
+/*
+ * @brief Retour sur trace séquentiel, comme PPQ_fluxRec
+ * Complexité : O(nombre de solutions * q / p1)
+ */
+void explorer(const Groupe *G, Tache *T, int q_restant, int *prefixe, int longueur){
+    if (q_restant == 0){
+        T->compte++;
+        if (G->conserver) memoriserSolution(T, prefixe, longueur);
+        return;
+    }
+    for (int i = G->p1; i <= G->p2 && i <= q_restant; i++){
+        prefixe[longueur] = i;
+        explorer(G, T, q_restant - i, prefixe, longueur + 1);
+    }
+}
+
+/*
+ * @brief Exécute une tâche : découpage en sous-tâches déposées dans la deque
+ *        du thread si elle est trop grosse, exploration séquentielle sinon
+ * @param G Le groupe de threads
+ * @param numero Numéro du thread exécutant
+ * @param T La tâche
+ * Complexité : O(p2 - p1) pour un découpage, celle d'explorer sinon
+ */
+void executer(Groupe *G, int numero, Tache *T){
+    if (G->estimation[T->q_restant] > GRAIN){
+        int max = (G->p2 < T->q_restant) ? G->p2 : T->q_restant;
+        T->nb_enfants = (max >= G->p1) ? max - G->p1 + 1 : 0;
+        T->enfants = (Tache **)allouer((T->nb_enfants + 1) * sizeof(Tache *));
+        for (int k = 0; k < T->nb_enfants; k++){
+            int i = G->p1 + k;
+            T->enfants[k] = creerTache(T->prefixe, T->longueur + 1, i, T->q_restant - i);
+            T->enfants[k]->parent = T;
+            T->enfants[k]->rang = k;
+        }
+        atomic_fetch_add(&G->en_attente, T->nb_enfants);
+        atomic_store(&T->terminee, true);
+        atomic_fetch_add(&G->deposees, T->nb_enfants);
+        // Dépôt à l'envers : le propriétaire reprend d'abord la plus petite valeur
+        for (int k = T->nb_enfants - 1; k >= 0; k--) deposer(&G->deques[numero], T->enfants[k]);
+        signalerDepot(G);
+        return;
+    }
+    int *prefixe = (int *)allouer((T->longueur + T->q_restant / G->p1 + 1) * sizeof(int));
+    memcpy(prefixe, T->prefixe, T->longueur * sizeof(int));
+    explorer(G, T, T->q_restant, prefixe, T->longueur);
+    free(prefixe);
+    if (G->conserver) atomic_fetch_add(&G->en_tampon, (long)T->nb_solutions);
+    atomic_store(&T->terminee, true);
+}
+
+// -------------------- Émission dans l'ordre --------------------
+
+/*
+ * @brief Fait avancer le curseur d'émission tant que la tâche qu'il désigne
+ *        est terminée : les solutions d'une feuille sont transmises à traiter
+ *        puis libérées, une tâche découpée mène à son premier enfant
+ * @param G Le groupe (verrou d'émission détenu)
+ * Complexité : O(tâches parcourues + solutions émises)
+ */
+void avancerCurseur(Groupe *G){
+    Tache *T = G->curseur;
+    while (T != NULL && atomic_load(&T->terminee)){
+        if (T->enfants != NULL && T->nb_enfants > 0){
+            T = T->enfants[0];
+            continue;
+        }
+        if (G->traiter != NULL){
+            size_t debut = 0;
+            for (size_t s = 0; s < T->nb_solutions; s++){
+                G->traiter(T->valeurs + debut, T->longueurs[s], G->ctx);
+                debut += T->longueurs[s];
+            }
+        }
+        G->total += T->compte;
+        if (G->conserver) atomic_fetch_sub(&G->en_tampon, (long)T->nb_solutions);
+        free(T->valeurs);
+        free(T->longueurs);
+        T->valeurs = NULL;
+        T->longueurs = NULL;
+        // Tâche suivante dans l'ordre préfixe : frère suivant, sinon celui d'un ancêtre
+        while (T->parent != NULL && T->rang == T->parent->nb_enfants - 1) T = T->parent;
+        T = (T->parent != NULL) ? T->parent->enfants[T->rang + 1] : NULL;
+    }
+    G->curseur = T;
+}
+
+/*
+ * @brief Signale qu'une tâche est terminée et émet ce qui peut l'être ; si un
+ *        autre thread émet déjà, il refera un passage avant de s'arrêter
+ * @param G Le groupe
+ * Complexité : celle d'avancerCurseur
+ */
+void emettrePret(Groupe *G){
+    pthread_mutex_lock(&G->emission);
+    if (G->emetteur_actif){
+        G->a_emettre = true;
+        pthread_mutex_unlock(&G->emission);
+        return;
+    }
+    G->emetteur_actif = true;
+    do {
+        G->a_emettre = false;
+        pthread_mutex_unlock(&G->emission);
+        avancerCurseur(G);   // traiter est appelé hors verrou, mais par un seul thread
+        pthread_mutex_lock(&G->emission);
+    } while (G->a_emettre);
+    G->emetteur_actif = false;
+    pthread_cond_broadcast(&G->emission_finie);
+    pthread_mutex_unlock(&G->emission);
+}
+
+/*
+ * @brief Si trop de solutions attendent d'être émises, attend la fin du
+ *        passage d'émission en cours au lieu d'en produire d'autres
+ * @param G Le groupe
+ * @return bool Vrai si le tampon est toujours plein : il faut alors aider le curseur
+ * Complexité : O(1) hors attente
+ */
+bool tamponPlein(Groupe *G){
+    if (!G->conserver || atomic_load(&G->en_tampon) <= LIMITE_TAMPON) return false;
+    pthread_mutex_lock(&G->emission);
+    while (G->emetteur_actif && atomic_load(&G->en_tampon) > LIMITE_TAMPON){
+        pthread_cond_wait(&G->emission_finie, &G->emission);
+    }
+    pthread_mutex_unlock(&G->emission);
+    return atomic_load(&G->en_tampon) > LIMITE_TAMPON;
+}
+
+// Boucle d'un thread : ses propres tâches d'abord, puis vol chez les autres
+void *travailler(void *arg){
+    Ouvrier *O = (Ouvrier *)arg;
+    Groupe *G = O->G;
+    int echecs = 0;
+    while (atomic_load(&G->en_attente) > 0){
+        // Trop de solutions en attente : on aide le curseur au lieu de prendre de l'avance
+        Tache *T = tamponPlein(G) ? prendrePremiere(G) : reprendre(&G->deques[O->numero]);
+        for (int k = 1; T == NULL && k < G->nb_threads; k++){
+            T = voler(&G->deques[(O->numero + k) % G->nb_threads]);
+        }
+        if (T == NULL){
+            if (++echecs < TOURS_AVANT_SOMMEIL){
+                sched_yield();
+            } else {
+                attendreTravail(G);
+                echecs = 0;
+            }
+            continue;
+        }
+        echecs = 0;
+        atomic_fetch_sub(&G->deposees, 1);
+        executer(G, O->numero, T);
+        emettrePret(G);
+        if (atomic_fetch_sub(&G->en_attente, 1) == 1){
+            // Dernière tâche : les threads endormis peuvent s'arrêter
+            pthread_mutex_lock(&G->sommeil);
+            pthread_cond_broadcast(&G->travail_dispo);
+            pthread_mutex_unlock(&G->sommeil);
+        }
+    }
+    return NULL;
+}
+
+// -------------------- Interface --------------------
+
+/*
+ * @brief Énumère en parallèle les listes d'entiers de [p1, p2] de somme q
+ * @param p1 Borne inférieure (p1 >= 1)
+ * @param p2 Borne supérieure
+ * @param q Somme cible
+ * @param nb_threads Nombre de threads
+ * @param traiter Fonction appelée sur chaque solution dans l'ordre de PPQ, au
+ *        fur et à mesure (jamais par deux threads à la fois), ou NULL pour
+ *        seulement compter (rien n'est alors mémorisé)
+ * @param ctx Contexte transmis à traiter
+ * @return long long Nombre de solutions
+ * Complexité : O(S * q / p1 / nb_threads) en temps, S = nombre de solutions
+ */
+long long PPQ_parallele(int p1, int p2, int q, int nb_threads, TraiterSolution traiter, void *ctx){
+    if (p1 < 1 || q < 0) return 0;
+    if (nb_threads < 1) nb_threads = 1;
+
+    Groupe G;
+    G.p1 = p1;
+    G.p2 = p2;
+    G.conserver = (traiter != NULL);
+    G.nb_threads = nb_threads;
+    atomic_init(&G.en_attente, 1);
+    atomic_init(&G.deposees, 1);   // la racine
+    pthread_mutex_init(&G.sommeil, NULL);
+    pthread_cond_init(&G.travail_dispo, NULL);
+    atomic_init(&G.endormis, 0);
+    G.traiter = traiter;
+    G.ctx = ctx;
+    pthread_mutex_init(&G.emission, NULL);
+    pthread_cond_init(&G.emission_finie, NULL);
+    G.emetteur_actif = false;
+    G.a_emettre = false;
+    atomic_init(&G.en_tampon, 0);
+    G.total = 0;
+
+    // Estimation du nombre de solutions de chaque somme (même récurrence que PPQ)
+    G.estimation = (double *)allouer((q + 1) * sizeof(double));
+    G.estimation[0] = 1.0;
+    for (int r = 1; r <= q; r++){
+        G.estimation[r] = 0.0;
+        for (int i = p1; i <= p2 && i <= r; i++) G.estimation[r] += G.estimation[r - i];
+    }
+
+    G.deques = (Deque *)allouer(nb_threads * sizeof(Deque));
+    for (int t = 0; t < nb_threads; t++){
+        G.deques[t].taches = NULL;
+        G.deques[t].bas = G.deques[t].haut = G.deques[t].capacite = 0;
+        pthread_mutex_init(&G.deques[t].verrou, NULL);
+    }
+
+    Tache *racine = creerTache(NULL, 0, 0, q);
+    G.curseur = racine;
+    deposer(&G.deques[0], racine);
+
+    pthread_t *threads = (pthread_t *)allouer(nb_threads * sizeof(pthread_t));
+    Ouvrier *ouvriers = (Ouvrier *)allouer(nb_threads * sizeof(Ouvrier));
+    for (int t = 0; t < nb_threads; t++){
+        ouvriers[t].G = &G;
+        ouvriers[t].numero = t;
+        if (pthread_create(&threads[t], NULL, travailler, &ouvriers[t]) != 0){
+            perror("Erreur pthread_create");
+            exit(EXIT_FAILURE);
+        }
+    }
+    for (int t = 0; t < nb_threads; t++) pthread_join(threads[t], NULL);
+
+    // Tout est terminé : ce dernier passage émet ce qui resterait
+    avancerCurseur(&G);
+    long long total = G.total;
+
+    libererTache(racine);
+    pthread_mutex_destroy(&G.emission);
+    pthread_cond_destroy(&G.emission_finie);
+    pthread_mutex_destroy(&G.sommeil);
+    pthread_cond_destroy(&G.travail_dispo);
+    for (int t = 0; t < nb_threads; t++){
+        pthread_mutex_destroy(&G.deques[t].verrou);
+        free(G.deques[t].taches);
+    }
+    free(G.deques);
+    free(G.estimation);
+    free(threads);
+    free(ouvriers);
+    return total;
+}
+
+// -------------------- Affichage --------------------
+void AfficherSolution(const int *solution, int longueur, void *ctx){
+    (void)ctx;
+    printf("[");
+    for (int i = 0; i < longueur; i++){
+        printf("%d", solution[i]);
+        if (i + 1 < longueur) printf(", ");
+    }
+    printf("] ");
+}
+
+// Empreinte dépendant de l'ordre des solutions, pour comparer deux énumérations
+void Empreinte(const int *solution, int longueur, void *ctx){
+    unsigned long long *h = (unsigned long long *)ctx;
+    for (int i = 0; i < longueur; i++) *h = (*h ^ (unsigned)solution[i]) * 1099511628211ULL;
+    *h = (*h ^ 0xff) * 1099511628211ULL;
+}
+
+double maintenant(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// -------------------- Main : exemple et passage à l'échelle --------------------
+int main(int argc, char *argv[]){
+    printf("Solutions pour p1=2, p2=4, q=9 (4 threads):\n");
+    PPQ_parallele(2, 4, 9, 4, AfficherSolution, NULL);
+    printf("\n");
+
+    // L'ordre est le même quel que soit le nombre de threads
+    unsigned long long h1 = 14695981039346656037ULL, h4 = h1;
+    PPQ_parallele(1, 3, 20, 1, Empreinte, &h1);
+    PPQ_parallele(1, 3, 20, 4, Empreinte, &h4);
+    printf("Ordre identique avec 1 et 4 threads : %s\n", h1 == h4 ? "Oui" : "Non");
+
+    int q = (argc > 1) ? atoi(argv[1]) : 30;
+    long coeurs = sysconf(_SC_NPROCESSORS_ONLN);
+    int max_threads = (argc > 2) ? atoi(argv[2]) : (int)(coeurs > 1 ? coeurs : 4);
+    if (max_threads < 1) max_threads = 1;
+
+    printf("Comptage pour p1=1, p2=3, q=%d :\n", q);
+    double reference = 0.0;
+    // Puissances de 2, puis max_threads lui-même s'il n'en est pas une
+    for (int t = 1; t <= max_threads; t = (t < max_threads && 2 * t > max_threads) ? max_threads : 2 * t){
+        double debut = maintenant();
+        long long nb = PPQ_parallele(1, 3, q, t, NULL, NULL);
+        double duree = maintenant() - debut;
+        if (t == 1) reference = duree;
+        printf("  %2d thread(s) : %lld solutions en %.3f s (accélération %.2f)\n",
+               t, nb, duree, reference / duree);
+    }
+    return 0;
+}
@@ -0,0 +1,686 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+/*
+ * Arbres Binaires - Parcours parallèle fork-join par vol de tâches
+ *
+ * Les fonctions de comptage et de vérification de TD1 et des examens sont des
+ * « diviser pour régner » sur SAG / SAD. Ces fichiers ne sont pas modifiés :
+ * leurs fonctions sont recopiées plus bas comme référence séquentielle, et
+ * ici elles s'expriment toutes par :
+ * - une étape, qui traite un nœud (ou une paire de nœuds pour Elagage) et
+ *   indique les sous-problèmes à explorer ;
+ * - une réduction associative (somme pour les comptages, et logique pour les
+ *   vérifications) avec, pour les vérifications, une valeur absorbante (faux).
+ *
+ * Le moteur parcourt l'arbre en profondeur. Jusqu'à une profondeur de coupure,
+ * ou quand des threads attendent du travail, le second sous-problème est
+ * déposé dans la deque du thread (fork) pendant qu'il traite le premier. Au
+ * retour (join), le thread reprend la tâche si personne ne l'a volée, sinon
+ * il vole lui-même d'autres tâches en attendant son résultat. Les threads
+ * inactifs volent la tâche la plus ancienne d'un autre thread, c'est-à-dire
+ * la plus proche de la racine ; après TOURS_AVANT_SOMMEIL tentatives
+ * infructueuses, ils s'endorment jusqu'au prochain dépôt de tâche ou jusqu'à
+ * la fin du travail. Dès qu'une vérification rencontre la valeur
+ * absorbante, un drapeau partagé arrête le travail de tous les threads.
+ *
+ * Les threads du groupe sont créés une fois (creerPool) et réutilisés d'un
+ * appel à l'autre. Le main compare les versions séquentielles aux versions
+ * parallèles sur un arbre équilibré et sur un arbre déséquilibré.
+ *
+ * Compilation : gcc -O2 -pthread Parallele_Arbres.c
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// -------------------- Définition de la structure --------------------
+typedef struct Noeud {
+    int valeur;
+    struct Noeud *SAG; // sous-arbre gauche
+    struct Noeud *SAD; // sous-arbre droit
+} Noeud;
+
+typedef Noeud *Arbre;
+
+// Sous-problème : un nœud, ou deux nœuds parcourus ensemble (Elagage)
+typedef struct {
+    Arbre a, b;
+} Paire;
+
+/*
+ * Étape d'une réduction : renvoie la contribution du sous-problème p et
+ * remplit enfants[0..*nb_enfants-1] avec les sous-problèmes à explorer.
+ */
+typedef long (*Etape)(Paire p, const void *params, Paire enfants[2], int *nb_enfants);
+
+typedef struct {
+    Etape etape;
+    long (*combiner)(long, long);   // associative, d'élément neutre `neutre`
+    long neutre;
+    bool court_circuit;             // une contribution égale à `absorbant` fixe le résultat
+    long absorbant;
+    const void *params;
+} Reduction;
+
+#define PROFONDEUR_MAX_DECOUPE 64   // au-delà, plus aucune tâche n'est déposée
+#define TOURS_AVANT_SOMMEIL 64      // vols infructueux avant qu'un thread inactif s'endorme
+
+enum { A_FAIRE, FINIE };
+
+typedef struct Tache {
+    Paire p;
+    int profondeur;
+    long resultat;
+    atomic_int etat;
+} Tache;
+
+// File à deux bouts d'un thread : le propriétaire travaille en haut, les voleurs prennent en bas
+typedef struct {
+    Tache **taches;
+    size_t bas, haut, capacite;
+    pthread_mutex_t verrou;
+} Deque;
+
+typedef struct Pool Pool;
+
+typedef struct {
+    Pool *P;
+    int numero;
+} Ouvrier;
+
+struct Pool {
+    int nb_threads;                 // y compris le thread appelant (numéro 0)
+    int coupure;                    // profondeur jusqu'à laquelle on découpe toujours
+    Deque *deques;
+    pthread_t *threads;
+    Ouvrier *ouvriers;
+    // Travail en cours
+    const Reduction *R;
+    atomic_bool arret;              // court-circuit atteint
+    atomic_bool termine;            // la racine est évaluée
+    atomic_int oisifs;              // threads qui cherchent du travail
+    atomic_int deposees;            // tâches en attente dans les deques
+    atomic_int engages;             // ouvriers pas encore sortis du travail courant
+    atomic_int endormis;            // ouvriers inactifs endormis sur travail_dispo
+    // Passage d'un travail au suivant
+    pthread_mutex_t verrou;
+    pthread_cond_t nouveau_travail;
+    pthread_cond_t travail_dispo;   // une tâche a été déposée ou le travail est fini
+    unsigned long generation;
+    bool fermeture;
+};
+
+// -------------------- Deque de tâches --------------------
+
+// Complexité : O(1) amorti
+void deposer(Deque *D, Tache *T){
+    pthread_mutex_lock(&D->verrou);
+    if (D->haut == D->capacite){
+        if (D->bas > 0){
+            memmove(D->taches, D->taches + D->bas, (D->haut - D->bas) * sizeof(Tache *));
+            D->haut -= D->bas;
+            D->bas = 0;
+        } else {
+            D->capacite = (D->capacite == 0) ? 64 : 2 * D->capacite;
+            Tache **taches = (Tache **)realloc(D->taches, D->capacite * sizeof(Tache *));
+            if (taches == NULL){
+                perror("Erreur d'allocation dans deposer");
+                exit(EXIT_FAILURE);
+            }
+            D->taches = taches;
+        }
+    }
+    D->taches[D->haut++] = T;
+    pthread_mutex_unlock(&D->verrou);
+}
+
+// Tâche la plus récente (propriétaire) ; NULL si vide
+// Complexité : O(1)
+Tache *reprendre(Deque *D){
+    Tache *T = NULL;
+    pthread_mutex_lock(&D->verrou);
+    if (D->haut > D->bas) T = D->taches[--D->haut];
+    if (D->haut == D->bas) D->haut = D->bas = 0;
+    pthread_mutex_unlock(&D->verrou);
+    return T;
+}
+
+// Tâche la plus ancienne (voleur) ; NULL si vide
+// Complexité : O(1)
+Tache *voler(Deque *D){
+    Tache *T = NULL;
+    pthread_mutex_lock(&D->verrou);
+    if (D->haut > D->bas) T = D->taches[D->bas++];
+    if (D->haut == D->bas) D->haut = D->bas = 0;
+    pthread_mutex_unlock(&D->verrou);
+    return T;
+}
+
+// Vole une tâche chez un autre thread que `numero`
+Tache *volerAilleurs(Pool *P, int numero){
+    for (int k = 1; k < P->nb_threads; k++){
+        Tache *T = voler(&P->deques[(numero + k) % P->nb_threads]);
+        if (T != NULL){
+            atomic_fetch_sub(&P->deposees, 1);
+            return T;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * @brief Endort un thread inactif jusqu'à ce qu'une tâche soit déposée ou que
+ *        le travail soit fini
+ * @param P Le groupe
+ * Complexité : O(1) hors attente
+ */
+void attendreTravail(Pool *P){
+    pthread_mutex_lock(&P->verrou);
+    atomic_fetch_add(&P->endormis, 1);
+    // endormis est incrémenté avant de relire deposees, et le déposant fait
+    // l'inverse : l'un des deux voit toujours l'autre
+    while (atomic_load(&P->deposees) == 0 && !atomic_load(&P->termine)){
+        pthread_cond_wait(&P->travail_dispo, &P->verrou);
+    }
+    atomic_fetch_sub(&P->endormis, 1);
+    pthread_mutex_unlock(&P->verrou);
+}
+
+// Réveille un thread endormi après un dépôt (rien à faire si aucun ne dort)
+// Complexité : O(1)
+void signalerDepot(Pool *P){
+    if (atomic_load(&P->endormis) == 0) return;
+    pthread_mutex_lock(&P->verrou);
+    pthread_cond_signal(&P->travail_dispo);
+    pthread_mutex_unlock(&P->verrou);
+}
+
+// -------------------- Évaluation --------------------
+
+// Découpe jusqu'à la profondeur de coupure, puis seulement si des threads
+// inactifs sont plus nombreux que les tâches déjà en attente
+static bool doitDecouper(Pool *P, int profondeur){
+    if (profondeur < P->coupure) return true;
+    return profondeur < PROFONDEUR_MAX_DECOUPE &&
+           atomic_load_explicit(&P->oisifs, memory_order_relaxed) >
+           atomic_load_explicit(&P->deposees, memory_order_relaxed);
+}
+
+void executerTache(Pool *P, int numero, Tache *T);
+
+/*
+ * @brief Évalue la réduction sur le sous-problème p, en déposant le second
+ *        sous-problème comme tâche quand il faut découper
+ * @param P Le groupe de threads
+ * @param numero Numéro du thread exécutant
+ * @param p Sous-problème
+ * @param profondeur Profondeur de p dans l'arbre
+ * @return long Résultat de la réduction sur p
+ * Complexité : O(taille du sous-arbre) au total, répartie entre les threads
+ */
+long evaluer(Pool *P, int numero, Paire p, int profondeur){
+    const Reduction *R = P->R;
+    if (R->court_circuit && atomic_load_explicit(&P->arret, memory_order_relaxed)) return R->neutre;
+
+    Paire enfants[2];
+    int k = 0;
+    long v = R->etape(p, R->params, enfants, &k);
+    if (R->court_circuit && v == R->absorbant){
+        atomic_store(&P->arret, true);
+        return v;
+    }
+
+    if (k == 2 && doitDecouper(P, profondeur)){
+        Tache t = {enfants[1], profondeur + 1, 0, A_FAIRE};
+        deposer(&P->deques[numero], &t);
+        atomic_fetch_add(&P->deposees, 1);
+        signalerDepot(P);
+        long r0 = evaluer(P, numero, enfants[0], profondeur + 1);
+        long r1;
+        if (reprendre(&P->deques[numero]) == &t){
+            // Personne ne l'a volée : on la traite soi-même
+            atomic_fetch_sub(&P->deposees, 1);
+            r1 = evaluer(P, numero, enfants[1], profondeur + 1);
+        } else {
+            // Volée : on aide les autres en attendant son résultat
+            while (atomic_load_explicit(&t.etat, memory_order_acquire) != FINIE){
+                Tache *autre = volerAilleurs(P, numero);
+                if (autre != NULL) executerTache(P, numero, autre);
+                else sched_yield();
+            }
+            r1 = t.resultat;
+        }
+        return R->combiner(v, R->combiner(r0, r1));
+    }
+
+    for (int i = 0; i < k; i++){
+        v = R->combiner(v, evaluer(P, numero, enfants[i], profondeur + 1));
+        if (R->court_circuit && v == R->absorbant) break;
+    }
+    return v;
+}
+
+void executerTache(Pool *P, int numero, Tache *T){
+    T->resultat = evaluer(P, numero, T->p, T->profondeur);
+    atomic_store_explicit(&T->etat, FINIE, memory_order_release);
+}
+
+// Boucle d'un thread du groupe : attend un travail, vole des tâches jusqu'à sa fin
+void *travailler(void *arg){
+    Ouvrier *O = (Ouvrier *)arg;
+    Pool *P = O->P;
+    unsigned long vue = 0;
+    for (;;){
+        pthread_mutex_lock(&P->verrou);
+        while (P->generation == vue && !P->fermeture) pthread_cond_wait(&P->nouveau_travail, &P->verrou);
+        if (P->fermeture){
+            pthread_mutex_unlock(&P->verrou);
+            return NULL;
+        }
+        vue = P->generation;
+        pthread_mutex_unlock(&P->verrou);
+
+        bool oisif = false;
+        int echecs = 0;
+        while (!atomic_load(&P->termine)){
+            Tache *T = volerAilleurs(P, O->numero);
+            if (T != NULL){
+                if (oisif){ atomic_fetch_sub(&P->oisifs, 1); oisif = false; }
+                echecs = 0;
+                executerTache(P, O->numero, T);
+            } else {
+                // Un thread endormi reste compté parmi les oisifs : doitDecouper
+                // continue de déposer des tâches, et chaque dépôt le réveille
+                if (!oisif){ atomic_fetch_add(&P->oisifs, 1); oisif = true; }
+                if (++echecs < TOURS_AVANT_SOMMEIL){
+                    sched_yield();
+                } else {
+                    attendreTravail(P);
+                    echecs = 0;
+                }
+            }
+        }
+        if (oisif) atomic_fetch_sub(&P->oisifs, 1);
+        atomic_fetch_sub(&P->engages, 1);
+    }
+}
+
+// -------------------- Groupe de threads --------------------
+
+/*
+ * @brief Crée un groupe de nb_threads threads (le thread appelant compris)
+ * @param nb_threads Nombre de threads
+ * @return Pool* Le groupe
+ * Complexité : O(nb_threads)
+ */
+Pool *creerPool(int nb_threads){
+    if (nb_threads < 1) nb_threads = 1;
+    Pool *P = (Pool *)calloc(1, sizeof(Pool));
+    if (P == NULL){
+        perror("Erreur d'allocation dans creerPool");
+        exit(EXIT_FAILURE);
+    }
+    P->nb_threads = nb_threads;
+    P->coupure = 4;
+    while ((1 << (P->coupure - 4)) < nb_threads) P->coupure++;   // environ 16 tâches par thread
+    P->deques = (Deque *)calloc(nb_threads, sizeof(Deque));
+    P->threads = (pthread_t *)calloc(nb_threads, sizeof(pthread_t));
+    P->ouvriers = (Ouvrier *)calloc(nb_threads, sizeof(Ouvrier));
+    if (P->deques == NULL || P->threads == NULL || P->ouvriers == NULL){
+        perror("Erreur d'allocation dans creerPool");
+        exit(EXIT_FAILURE);
+    }
+    for (int t = 0; t < nb_threads; t++) pthread_mutex_init(&P->deques[t].verrou, NULL);
+    pthread_mutex_init(&P->verrou, NULL);
+    pthread_cond_init(&P->nouveau_travail, NULL);
+    pthread_cond_init(&P->travail_dispo, NULL);
+    for (int t = 1; t < nb_threads; t++){
+        P->ouvriers[t] = (Ouvrier){P, t};
+        if (pthread_create(&P->threads[t], NULL, travailler, &P->ouvriers[t]) != 0){
+            perror("Erreur pthread_create");
+            exit(EXIT_FAILURE);
+        }
+    }
+    return P;
+}
+
+void detruirePool(Pool *P){
+    pthread_mutex_lock(&P->verrou);
+    P->fermeture = true;
+    pthread_cond_broadcast(&P->nouveau_travail);
+    pthread_mutex_unlock(&P->verrou);
+    for (int t = 1; t < P->nb_threads; t++) pthread_join(P->threads[t], NULL);
+    for (int t = 0; t < P->nb_threads; t++){
+        pthread_mutex_destroy(&P->deques[t].verrou);
+        free(P->deques[t].taches);
+    }
+    pthread_mutex_destroy(&P->verrou);
+    pthread_cond_destroy(&P->nouveau_travail);
+    pthread_cond_destroy(&P->travail_dispo);
+    free(P->deques);
+    free(P->threads);
+    free(P->ouvriers);
+    free(P);
+}
+
+/*
+ * @brief Évalue une réduction sur tout l'arbre avec les threads du groupe
+ * @param P Le groupe
+ * @param R La réduction
+ * @param racine Sous-problème de départ
+ * @return long Le résultat
+ * Complexité : O(n / nb_threads + profondeur) dans le meilleur cas
+ */
+long reduireParallele(Pool *P, const Reduction *R, Paire racine){
+    P->R = R;
+    atomic_store(&P->arret, false);
+    atomic_store(&P->termine, false);
+    atomic_store(&P->engages, P->nb_threads - 1);
+    pthread_mutex_lock(&P->verrou);
+    P->generation++;
+    pthread_cond_broadcast(&P->nouveau_travail);
+    pthread_mutex_unlock(&P->verrou);
+
+    long resultat = evaluer(P, 0, racine, 0);
+    if (R->court_circuit && atomic_load(&P->arret)) resultat = R->absorbant;
+
+    atomic_store(&P->termine, true);
+    pthread_mutex_lock(&P->verrou);
+    pthread_cond_broadcast(&P->travail_dispo);
+    pthread_mutex_unlock(&P->verrou);
+    while (atomic_load(&P->engages) > 0) sched_yield();
+    return resultat;
+}
+
+// Même réduction sur un seul thread, sans groupe
+// Complexité : O(n)
+long reduireSequentiel(const Reduction *R, Paire p){
+    Paire enfants[2];
+    int k = 0;
+    long v = R->etape(p, R->params, enfants, &k);
+    for (int i = 0; i < k && !(R->court_circuit && v == R->absorbant); i++){
+        v = R->combiner(v, reduireSequentiel(R, enfants[i]));
+    }
+    return v;
+}
+
+// -------------------- Étapes des fonctions de TD1 et des examens --------------------
+long somme(long x, long y){ return x + y; }
+long et(long x, long y){ return x && y; }
+
+bool estFeuille(Arbre a){
+    return a != NULL && a->SAG == NULL && a->SAD == NULL;
+}
+
+// Ajoute les fils non vides de a aux sous-problèmes
+static void fils(Arbre a, Paire enfants[2], int *k){
+    if (a->SAG != NULL) enfants[(*k)++] = (Paire){a->SAG, NULL};
+    if (a->SAD != NULL) enfants[(*k)++] = (Paire){a->SAD, NULL};
+}
+
+// CompteSansAsc / CompteSansDesc (TD1) : nœuds non nuls dont aucun fils n'est non nul,
+// sans descendre sous un nœud nul
+long etapeCompteSans(Paire p, const void *params, Paire enfants[2], int *k){
+    (void)params;
+    Arbre a = p.a;
+    if (a->valeur == 0) return 0;
+    int gauche = (a->SAG && a->SAG->valeur), droit = (a->SAD && a->SAD->valeur);
+    fils(a, enfants, k);
+    return (!gauche && !droit);
+}
+
+// CompteFVrai (examen 2024-2025) : feuilles valant 1
+long etapeCompteFVrai(Paire p, const void *params, Paire enfants[2], int *k){
+    (void)params;
+    if (estFeuille(p.a)) return p.a->valeur == 1;
+    fils(p.a, enfants, k);
+    return 0;
+}
+
+// CompteXOuPlusDansABR (examen 2024-2025) : nœuds internes >= x ; à gauche
+// d'un nœud < x, tout est < x
+long etapeCompteXOuPlus(Paire p, const void *params, Paire enfants[2], int *k){
+    int x = *(const int *)params;
+    Arbre a = p.a;
+    if (a->valeur < x){
+        if (a->SAD != NULL) enfants[(*k)++] = (Paire){a->SAD, NULL};
+        return 0;
+    }
+    fils(a, enfants, k);
+    return !estFeuille(a);
+}
+
+// TOUTBLANC (examen 2023-2024) : toutes les feuilles valent 1
+long etapeToutBlanc(Paire p, const void *params, Paire enfants[2], int *k){
+    (void)params;
+    if (estFeuille(p.a)) return p.a->valeur == 1;
+    fils(p.a, enfants, k);
+    return 1;
+}
+
+// Elagage (examen 2023-2024) : a1 est un élagage de a2, parcours simultané
+long etapeElagage(Paire p, const void *params, Paire enfants[2], int *k){
+    (void)params;
+    Arbre a1 = p.a, a2 = p.b;
+    if (a1 == NULL) return 1;
+    if (a2 == NULL) return 0;
+    if (estFeuille(a1)) return 1;
+    if (a1->valeur != a2->valeur) return 0;
+    enfants[(*k)++] = (Paire){a1->SAG, a2->SAG};
+    enfants[(*k)++] = (Paire){a1->SAD, a2->SAD};
+    return 1;
+}
+
+// -------------------- Interface parallèle --------------------
+// P == NULL : version séquentielle avec la même étape
+
+long lancer(Pool *P, const Reduction *R, Paire racine){
+    return (P == NULL) ? reduireSequentiel(R, racine) : reduireParallele(P, R, racine);
+}
+
+int CompteSansAsc_Par(Pool *P, Arbre A){
+    if (A == NULL) return 0;
+    Reduction R = {etapeCompteSans, somme, 0, false, 0, NULL};
+    return (int)lancer(P, &R, (Paire){A, NULL});
+}
+
+int CompteSansDesc_Par(Pool *P, Arbre A){
+    return CompteSansAsc_Par(P, A);   // même définition que dans TD1
+}
+
+int CompteFVrai_Par(Pool *P, Arbre A){
+    if (A == NULL) return 0;
+    Reduction R = {etapeCompteFVrai, somme, 0, false, 0, NULL};
+    return (int)lancer(P, &R, (Paire){A, NULL});
+}
+
+int CompteXOuPlusDansABR_Par(Pool *P, Arbre A, int x){
+    if (A == NULL) return 0;
+    Reduction R = {etapeCompteXOuPlus, somme, 0, false, 0, &x};
+    return (int)lancer(P, &R, (Paire){A, NULL});
+}
+
+bool TOUTBLANC_Par(Pool *P, Arbre A){
+    if (A == NULL) return true;
+    Reduction R = {etapeToutBlanc, et, 1, true, 0, NULL};
+    return lancer(P, &R, (Paire){A, NULL}) != 0;
+}
+
+bool Elagage_Par(Pool *P, Arbre a1, Arbre a2){
+    Reduction R = {etapeElagage, et, 1, true, 0, NULL};
+    return lancer(P, &R, (Paire){a1, a2}) != 0;
+}
+
+// -------------------- Versions récursives d'origine --------------------
+int CompteSansAsc(Arbre racine){
+    if (!racine || racine->valeur == 0) return 0;
+    int leftVal = (racine->SAG && racine->SAG->valeur);
+    int rightVal = (racine->SAD && racine->SAD->valeur);
+    if (!leftVal && !rightVal)
+        return 1 + CompteSansAsc(racine->SAG) + CompteSansAsc(racine->SAD);
+    else
+        return CompteSansAsc(racine->SAG) + CompteSansAsc(racine->SAD);
+}
+
+int CompteFVrai(Arbre A){
+    if (A == NULL) return 0;
+    if (A->SAG == NULL && A->SAD == NULL) return A->valeur == 1;
+    return CompteFVrai(A->SAG) + CompteFVrai(A->SAD);
+}
+
+int CompteXOuPlusDansABR(Arbre A, int x){
+    if (A == NULL) return 0;
+    int cpt = 0;
+    bool estInterne = (A->SAG != NULL || A->SAD != NULL);
+    if (estInterne && A->valeur >= x) cpt = 1;
+    if (A->valeur < x) return CompteXOuPlusDansABR(A->SAD, x);
+    return cpt + CompteXOuPlusDansABR(A->SAG, x) + CompteXOuPlusDansABR(A->SAD, x);
+}
+
+bool TOUTBLANC(Arbre a){
+    if (a == NULL) return true;
+    if (estFeuille(a)) return a->valeur == 1;
+    return TOUTBLANC(a->SAG) && TOUTBLANC(a->SAD);
+}
+
+bool Elagage(Arbre a1, Arbre a2){
+    if (a1 == NULL) return true;
+    if (a2 == NULL) return false;
+    if (estFeuille(a1)) return true;
+    if (a1->valeur != a2->valeur) return false;
+    return Elagage(a1->SAG, a2->SAG) && Elagage(a1->SAD, a2->SAD);
+}
+
+// -------------------- Arbres de test --------------------
+Arbre creerNoeud(int v){
+    Arbre N = (Arbre)malloc(sizeof(Noeud));
+    if (N == NULL){
+        perror("Erreur d'allocation dans creerNoeud");
+        exit(EXIT_FAILURE);
+    }
+    N->valeur = v;
+    N->SAG = N->SAD = NULL;
+    return N;
+}
+
+/*
+ * @brief ABR des clés [debut, debut + n) ; le sous-arbre gauche reçoit la
+ *        proportion `gauche` des nœuds (0.5 : équilibré)
+ * Complexité : O(n)
+ */
+Arbre construire(int debut, int n, double gauche){
+    if (n <= 0) return NULL;
+    int ng = (int)((n - 1) * gauche);
+    Arbre A = creerNoeud(debut + ng);
+    A->SAG = construire(debut, ng, gauche);
+    A->SAD = construire(debut + ng + 1, n - 1 - ng, gauche);
+    return A;
+}
+
+// Copie en arbre de couleurs : feuilles blanches (1), nœuds internes de couleur pseudo-aléatoire
+Arbre colorier(Arbre A){
+    if (A == NULL) return NULL;
+    Arbre C = creerNoeud(estFeuille(A) ? 1 : (int)((A->valeur * 2654435761u) >> 31));
+    C->SAG = colorier(A->SAG);
+    C->SAD = colorier(A->SAD);
+    return C;
+}
+
+void detruireArbre(Arbre A){
+    if (A == NULL) return;
+    detruireArbre(A->SAG);
+    detruireArbre(A->SAD);
+    free(A);
+}
+
+// Feuille la plus à droite : la dernière atteinte par un parcours séquentiel
+Arbre derniereFeuille(Arbre A){
+    while (!estFeuille(A)) A = (A->SAD != NULL) ? A->SAD : A->SAG;
+    return A;
+}
+
+double maintenant(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// -------------------- Main : vérification et passage à l'échelle --------------------
+/*
+ * Mesure les cinq fonctions sur l'ABR A (clés 0..n-1) et sur sa copie en
+ * couleurs C. Les vérifications fausses placent le défaut sur la feuille la
+ * plus à droite : un parcours séquentiel ne le trouve qu'à la fin, un thread
+ * qui a volé le sous-arbre droit le trouve tôt et arrête les autres.
+ */
+void mesurer(const char *nom, Arbre A, Arbre C, int n, int max_threads){
+    int x = 3 * n / 4;
+    Arbre fin = derniereFeuille(C);
+
+    double t0 = maintenant();
+    long ref = CompteSansAsc(C) + CompteFVrai(C) + CompteXOuPlusDansABR(A, x) +
+               TOUTBLANC(C) + Elagage(C, C);
+    double sequentiel = maintenant() - t0;
+    fin->valeur = 0;
+    t0 = maintenant();
+    bool faux = TOUTBLANC(C);
+    double sequentiel_faux = maintenant() - t0;
+    fin->valeur = 1;
+
+    printf("%s : séquentiel %.3f s (TOUTBLANC faux : %.4f s)\n", nom, sequentiel, sequentiel_faux);
+    // Puissances de 2, puis max_threads lui-même s'il n'en est pas une
+    for (int t = 1; t <= max_threads; t = (t < max_threads && 2 * t > max_threads) ? max_threads : 2 * t){
+        Pool *P = creerPool(t);
+        t0 = maintenant();
+        long r = CompteSansAsc_Par(P, C) + CompteFVrai_Par(P, C) + CompteXOuPlusDansABR_Par(P, A, x) +
+                 TOUTBLANC_Par(P, C) + Elagage_Par(P, C, C);
+        double duree = maintenant() - t0;
+        fin->valeur = 0;
+        t0 = maintenant();
+        bool f = TOUTBLANC_Par(P, C);
+        double duree_faux = maintenant() - t0;
+        fin->valeur = 1;
+        printf("  %2d thread(s) : %.3f s (accélération %.2f), TOUTBLANC faux : %.4f s, résultats %s\n",
+               t, duree, sequentiel / duree, duree_faux, (r == ref && f == faux) ? "identiques" : "différents");
+        detruirePool(P);
+    }
+}
+
+int main(int argc, char *argv[]){
+    // Petit arbre de TD1
+    Arbre racine = creerNoeud(1);
+    racine->SAG = creerNoeud(0);
+    racine->SAD = creerNoeud(1);
+    racine->SAD->SAG = creerNoeud(1);
+    racine->SAD->SAD = creerNoeud(0);
+    Pool *P = creerPool(2);
+    printf("CompteSansAsc : %d (séquentiel %d)\n", CompteSansAsc_Par(P, racine), CompteSansAsc(racine));
+    printf("CompteFVrai : %d, TOUTBLANC : %s, Elagage(A, A) : %s\n", CompteFVrai_Par(P, racine),
+           TOUTBLANC_Par(P, racine) ? "Vrai" : "Faux", Elagage_Par(P, racine, racine) ? "Vrai" : "Faux");
+    detruirePool(P);
+    detruireArbre(racine);
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    long coeurs = sysconf(_SC_NPROCESSORS_ONLN);
+    int max_threads = (argc > 2) ? atoi(argv[2]) : (int)(coeurs > 1 ? coeurs : 4);
+    if (max_threads < 1) max_threads = 1;
+    printf("\n%d nœuds, %ld cœur(s) :\n", n, coeurs);
+
+    Arbre A = construire(0, n, 0.5), C = colorier(A);
+    mesurer("Arbre équilibré", A, C, n, max_threads);
+    detruireArbre(A);
+    detruireArbre(C);
+
+    A = construire(0, n, 0.9);
+    C = colorier(A);
+    mesurer("Arbre déséquilibré (90 % à gauche)", A, C, n, max_threads);
+    detruireArbre(A);
+    detruireArbre(C);
+    return 0;
+}
@@ -0,0 +1,587 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Arbres Binaires - Codage succinct des arbres de couleurs
+ *
+ * Les arbres d'images noir et blanc de l'examen 2023-2024 (TOUTBLANC,
+ * SIMPLIFIE, Elagage) ne portent qu'un bit de couleur et deux bits de forme
+ * par nœud, mais un Noeud occupe 24 octets (32 avec l'en-tête de malloc).
+ *
+ * ArbreSuccinct est une représentation en lecture seule, sans pointeur :
+ * - les nœuds sont numérotés dans l'ordre du parcours en largeur (racine 0) ;
+ * - forme (LOUDS binaire) : les bits 2i et 2i + 1 indiquent si le nœud i a un
+ *   fils gauche, un fils droit ;
+ * - couleurs : le bit i est la valeur du nœud i (0 noir, 1 blanc).
+ * Le fils dont le bit de forme est en position j porte le numéro
+ * 1 + rang1(j) (nombre de 1 avant j) ; le père du nœud k est en position
+ * select1(k - 1). rang1 est en temps constant grâce à un compteur par bloc de
+ * 512 bits ; select1 part d'un échantillon tous les 512 bits à 1.
+ * Le tout tient en un peu plus de 3 bits par nœud.
+ *
+ * TOUTBLANC, SIMPLIFIE et Elagage travaillent directement sur ce codage ;
+ * SIMPLIFIE produit un nouvel ArbreSuccinct.
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// -------------------- Définition de la structure --------------------
+typedef struct Noeud {
+    int valeur;
+    struct Noeud *SAG; // sous-arbre gauche
+    struct Noeud *SAD; // sous-arbre droit
+} Noeud;
+
+typedef Noeud *Arbre;
+
+#define BITS_BLOC 512                // bits par compteur de rang
+#define MOTS_BLOC (BITS_BLOC / 64)
+#define PAS_ECHANTILLON 512          // bits à 1 entre deux échantillons de select
+#define AUCUN SIZE_MAX               // pas de fils / pas de père
+
+typedef struct {
+    uint64_t *mots;
+    size_t nb_bits;
+    uint32_t *rangs;                 // nombre de 1 avant chaque bloc (NULL si non indexé ; nb_bits <= UINT32_MAX)
+    uint32_t *echantillons;          // bloc contenant le (k * PAS_ECHANTILLON)-ième 1
+    size_t nb_uns;
+} VecteurBits;
+
+typedef struct {
+    size_t n;                        // nombre de nœuds
+    VecteurBits forme;               // 2n bits
+    VecteurBits couleurs;            // n bits
+} ArbreSuccinct;
+
+// -------------------- Vecteur de bits --------------------
+
+VecteurBits creerVecteur(size_t nb_bits){
+    VecteurBits V = {NULL, nb_bits, NULL, NULL, 0};
+    V.mots = (uint64_t *)calloc(nb_bits / 64 + 1, sizeof(uint64_t));
+    if (V.mots == NULL){
+        perror("Erreur d'allocation dans creerVecteur");
+        exit(EXIT_FAILURE);
+    }
+    return V;
+}
+
+void detruireVecteur(VecteurBits *V){
+    free(V->mots);
+    free(V->rangs);
+    free(V->echantillons);
+    *V = (VecteurBits){NULL, 0, NULL, NULL, 0};
+}
+
+static inline bool lireBit(const VecteurBits *V, size_t i){
+    return (V->mots[i >> 6] >> (i & 63)) & 1;
+}
+
+static inline void mettreBit(VecteurBits *V, size_t i){
+    V->mots[i >> 6] |= (uint64_t)1 << (i & 63);
+}
+
+/*
+ * @brief Construit les compteurs de rang et les échantillons de select ;
+ *        les compteurs sont sur 32 bits, le vecteur ne doit donc pas dépasser
+ *        UINT32_MAX bits
+ * @param V Le vecteur, dont les bits ne changeront plus
+ * Complexité : O(nb_bits / 64)
+ */
+void indexerVecteur(VecteurBits *V){
+    if (V->nb_bits > UINT32_MAX){
+        fprintf(stderr, "Erreur dans indexerVecteur : %zu bits, les rangs 32 bits en permettent au plus %u\n",
+                V->nb_bits, UINT32_MAX);
+        exit(EXIT_FAILURE);
+    }
+    size_t nb_mots = V->nb_bits / 64 + 1;
+    size_t nb_blocs = nb_mots / MOTS_BLOC + 1;
+    V->rangs = (uint32_t *)malloc(nb_blocs * sizeof(uint32_t));
+    if (V->rangs == NULL){
+        perror("Erreur d'allocation dans indexerVecteur");
+        exit(EXIT_FAILURE);
+    }
+    uint32_t total = 0;
+    for (size_t w = 0; w < nb_mots; w++){
+        if (w % MOTS_BLOC == 0) V->rangs[w / MOTS_BLOC] = total;
+        total += __builtin_popcountll(V->mots[w]);
+    }
+    for (size_t b = (nb_mots + MOTS_BLOC - 1) / MOTS_BLOC; b < nb_blocs; b++) V->rangs[b] = total;
+    V->nb_uns = total;
+
+    V->echantillons = (uint32_t *)malloc((total / PAS_ECHANTILLON + 1) * sizeof(uint32_t));
+    if (V->echantillons == NULL){
+        perror("Erreur d'allocation dans indexerVecteur");
+        exit(EXIT_FAILURE);
+    }
+    size_t b = 0;
+    for (size_t k = 0; k <= total / PAS_ECHANTILLON; k++){
+        // dernier bloc dont le rang de départ est <= k * PAS_ECHANTILLON
+        while (b + 1 < nb_blocs && V->rangs[b + 1] <= k * PAS_ECHANTILLON) b++;
+        V->echantillons[k] = (uint32_t)b;
+    }
+}
+
+// Nombre de 1 dans [0, i)
+// Complexité : O(1) (au plus MOTS_BLOC mots comptés)
+size_t rang1(const VecteurBits *V, size_t i){
+    size_t w = i >> 6;
+    size_t r = V->rangs[w / MOTS_BLOC];
+    for (size_t m = w - w % MOTS_BLOC; m < w; m++) r += __builtin_popcountll(V->mots[m]);
+    if (i & 63) r += __builtin_popcountll(V->mots[w] & (((uint64_t)1 << (i & 63)) - 1));
+    return r;
+}
+
+// Position du k-ième 1 (k à partir de 0)
+// Complexité : O(1) en pratique (échantillon, puis blocs et mots jusqu'au bon bit)
+size_t select1(const VecteurBits *V, size_t k){
+    size_t nb_blocs = (V->nb_bits / 64 + 1) / MOTS_BLOC + 1;
+    size_t b = V->echantillons[k / PAS_ECHANTILLON];
+    while (b + 1 < nb_blocs && V->rangs[b + 1] <= k) b++;
+    size_t r = k - V->rangs[b];
+    for (size_t w = b * MOTS_BLOC;; w++){
+        size_t c = __builtin_popcountll(V->mots[w]);
+        if (r < c){
+            uint64_t x = V->mots[w];
+            for (; r > 0; r--) x &= x - 1;   // efface les r premiers 1
+            return w * 64 + __builtin_ctzll(x);
+        }
+        r -= c;
+    }
+}
+
+// -------------------- Navigation --------------------
+
+static inline bool estFeuilleS(const ArbreSuccinct *T, size_t i){
+    return ((T->forme.mots[(2 * i) >> 6] >> ((2 * i) & 63)) & 3) == 0;
+}
+
+static inline int couleur(const ArbreSuccinct *T, size_t i){
+    return lireBit(&T->couleurs, i);
+}
+
+// Complexité : O(1)
+size_t filsGauche(const ArbreSuccinct *T, size_t i){
+    return lireBit(&T->forme, 2 * i) ? 1 + rang1(&T->forme, 2 * i) : AUCUN;
+}
+
+// Complexité : O(1)
+size_t filsDroit(const ArbreSuccinct *T, size_t i){
+    return lireBit(&T->forme, 2 * i + 1) ? 1 + rang1(&T->forme, 2 * i + 1) : AUCUN;
+}
+
+// Complexité : O(1) en pratique
+size_t pere(const ArbreSuccinct *T, size_t k){
+    return (k == 0) ? AUCUN : select1(&T->forme, k - 1) / 2;
+}
+
+void detruireSuccinct(ArbreSuccinct *T){
+    detruireVecteur(&T->forme);
+    detruireVecteur(&T->couleurs);
+    T->n = 0;
+}
+
+// Octets occupés par le codage (bits, compteurs et échantillons)
+size_t octetsSuccinct(const ArbreSuccinct *T){
+    size_t mots = (T->forme.nb_bits / 64 + 1) + (T->couleurs.nb_bits / 64 + 1);
+    size_t blocs = (T->forme.nb_bits / 64 + 1) / MOTS_BLOC + 1;
+    return mots * sizeof(uint64_t) + blocs * sizeof(uint32_t) +
+           (T->forme.nb_uns / PAS_ECHANTILLON + 1) * sizeof(uint32_t);
+}
+
+// -------------------- Conversions --------------------
+
+size_t compterNoeuds(Arbre A){
+    if (A == NULL) return 0;
+    return 1 + compterNoeuds(A->SAG) + compterNoeuds(A->SAD);
+}
+
+/*
+ * @brief Code un arbre de couleurs (valeurs 0 ou 1) sous forme succincte
+ * @param A Racine de l'arbre (au plus UINT32_MAX / 2 nœuds : les 2n bits de
+ *        forme sont indexés par des rangs 32 bits)
+ * @return ArbreSuccinct Le codage
+ * Complexité : O(n)
+ */
+ArbreSuccinct encoderArbre(Arbre A){
+    ArbreSuccinct T;
+    T.n = compterNoeuds(A);
+    if (T.n > UINT32_MAX / 2){
+        fprintf(stderr, "Erreur dans encoderArbre : %zu nœuds, le codage en accepte au plus %u\n",
+                T.n, UINT32_MAX / 2);
+        exit(EXIT_FAILURE);
+    }
+    T.forme = creerVecteur(2 * T.n);
+    T.couleurs = creerVecteur(T.n);
+    Arbre *file = (Arbre *)malloc((T.n + 1) * sizeof(Arbre));
+    if (file == NULL){
+        perror("Erreur d'allocation dans encoderArbre");
+        exit(EXIT_FAILURE);
+    }
+    size_t fin = 0;
+    if (A != NULL) file[fin++] = A;
+    for (size_t i = 0; i < fin; i++){
+        Arbre a = file[i];
+        if (a->valeur != 0 && a->valeur != 1){
+            fprintf(stderr, "Erreur dans encoderArbre : valeur %d qui n'est pas une couleur\n", a->valeur);
+            exit(EXIT_FAILURE);
+        }
+        if (a->valeur) mettreBit(&T.couleurs, i);
+        if (a->SAG != NULL){ mettreBit(&T.forme, 2 * i); file[fin++] = a->SAG; }
+        if (a->SAD != NULL){ mettreBit(&T.forme, 2 * i + 1); file[fin++] = a->SAD; }
+    }
+    free(file);
+    indexerVecteur(&T.forme);
+    return T;
+}
+
+/*
+ * @brief Reconstruit l'arbre de pointeurs à partir du codage
+ * @param T Le codage
+ * @return Arbre La racine (NULL pour l'arbre vide)
+ * Complexité : O(n)
+ */
+Arbre decoderArbre(const ArbreSuccinct *T){
+    if (T->n == 0) return NULL;
+    Arbre *noeuds = (Arbre *)malloc(T->n * sizeof(Arbre));
+    if (noeuds == NULL){
+        perror("Erreur d'allocation dans decoderArbre");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < T->n; i++){
+        noeuds[i] = (Arbre)malloc(sizeof(Noeud));
+        if (noeuds[i] == NULL){
+            perror("Erreur d'allocation dans decoderArbre");
+            exit(EXIT_FAILURE);
+        }
+    }
+    // Les fils apparaissent dans l'ordre de leurs bits de forme
+    size_t suivant = 1;
+    for (size_t i = 0; i < T->n; i++){
+        Arbre a = noeuds[i];
+        a->valeur = couleur(T, i);
+        a->SAG = lireBit(&T->forme, 2 * i) ? noeuds[suivant++] : NULL;
+        a->SAD = lireBit(&T->forme, 2 * i + 1) ? noeuds[suivant++] : NULL;
+    }
+    Arbre racine = noeuds[0];
+    free(noeuds);
+    return racine;
+}
+
+// -------------------- Fonctions de l'examen sur le codage --------------------
+
+// Répartit les 32 bits de x sur les positions paires d'un mot de 64 bits
+static inline uint64_t etaler(uint64_t x){
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8))  & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4))  & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2))  & 0x3333333333333333ULL;
+    x = (x | (x << 1))  & 0x5555555555555555ULL;
+    return x;
+}
+
+/*
+ * @brief Vérifie si toutes les feuilles valent 1
+ * @param T Le codage
+ * @return bool Vrai si aucune feuille n'est noire
+ * Complexité : O(n / 32) : un mot de forme couvre 32 nœuds, sans navigation
+ */
+bool TOUTBLANC_Succinct(const ArbreSuccinct *T){
+    size_t nb_mots = (2 * T->n + 63) / 64;
+    for (size_t w = 0; w < nb_mots; w++){
+        uint64_t f = T->forme.mots[w];
+        uint64_t feuilles = ~(f | (f >> 1)) & 0x5555555555555555ULL;   // bit 2j : nœud 32w + j sans fils
+        if (w == nb_mots - 1 && (2 * T->n) % 64 != 0)
+            feuilles &= ((uint64_t)1 << ((2 * T->n) % 64)) - 1;          // nœuds au-delà de n
+        uint64_t blancs = etaler((T->couleurs.mots[w / 2] >> (32 * (w % 2))) & 0xFFFFFFFFULL);
+        if (feuilles & ~blancs) return false;
+    }
+    return true;
+}
+
+/*
+ * @brief SIMPLIFIE sur le codage : un nœud dont les deux fils sont des
+ *        feuilles de même couleur (après simplification) devient une feuille
+ * @param T Le codage d'origine (inchangé)
+ * @return ArbreSuccinct Le codage de l'arbre simplifié
+ * Complexité : O(n), deux passes sur les bits
+ */
+ArbreSuccinct SIMPLIFIE_Succinct(const ArbreSuccinct *T){
+    size_t n = T->n;
+    VecteurBits feuille = creerVecteur(n), reduit = creerVecteur(n), coul = creerVecteur(n);
+    memcpy(coul.mots, T->couleurs.mots, (n / 64 + 1) * sizeof(uint64_t));
+
+    // Les fils ont des numéros plus grands que leur père : on remonte de n - 1 à 0.
+    // En remontant, les fils de i sont les derniers numéros pas encore attribués,
+    // ce qui évite rang1.
+    size_t suivant = n;
+    for (size_t i = n; i-- > 0;){
+        size_t d = lireBit(&T->forme, 2 * i + 1) ? --suivant : AUCUN;
+        size_t g = lireBit(&T->forme, 2 * i) ? --suivant : AUCUN;
+        if (g == AUCUN && d == AUCUN){
+            mettreBit(&feuille, i);
+        } else if (g != AUCUN && d != AUCUN && lireBit(&feuille, g) && lireBit(&feuille, d) &&
+                   lireBit(&coul, g) == lireBit(&coul, d)){
+            mettreBit(&feuille, i);
+            mettreBit(&reduit, i);
+            coul.mots[i >> 6] = (coul.mots[i >> 6] & ~((uint64_t)1 << (i & 63))) |
+                                ((uint64_t)lireBit(&coul, g) << (i & 63));
+        }
+    }
+
+    // Les nœuds conservés gardent leur ordre en largeur : on les renumérote dans l'ordre
+    VecteurBits garde = creerVecteur(n);
+    size_t m = 0;
+    suivant = 1;
+    if (n > 0) mettreBit(&garde, 0);
+    for (size_t i = 0; i < n; i++){
+        size_t g = lireBit(&T->forme, 2 * i) ? suivant++ : AUCUN;
+        size_t d = lireBit(&T->forme, 2 * i + 1) ? suivant++ : AUCUN;
+        if (!lireBit(&garde, i)) continue;
+        m++;
+        if (lireBit(&reduit, i)) continue;
+        if (g != AUCUN) mettreBit(&garde, g);
+        if (d != AUCUN) mettreBit(&garde, d);
+    }
+    ArbreSuccinct S = {m, creerVecteur(2 * m), creerVecteur(m)};
+    size_t j = 0;
+    for (size_t i = 0; i < n; i++){
+        if (!lireBit(&garde, i)) continue;
+        if (lireBit(&coul, i)) mettreBit(&S.couleurs, j);
+        if (!lireBit(&reduit, i)){
+            if (lireBit(&T->forme, 2 * i)) mettreBit(&S.forme, 2 * j);
+            if (lireBit(&T->forme, 2 * i + 1)) mettreBit(&S.forme, 2 * j + 1);
+        }
+        j++;
+    }
+    indexerVecteur(&S.forme);
+    detruireVecteur(&feuille);
+    detruireVecteur(&reduit);
+    detruireVecteur(&coul);
+    detruireVecteur(&garde);
+    return S;
+}
+
+typedef struct {
+    size_t i1, i2;
+} PaireNoeuds;
+
+/*
+ * @brief Vérifie si T1 est un élagage de T2 (même définition que Elagage)
+ * @param T1 Codage de l'arbre élagué
+ * @param T2 Codage de l'arbre complet
+ * @return bool Vrai si T1 est un élagage de T2
+ * Complexité : O(n1), parcours simultané avec une pile de paires
+ */
+bool Elagage_Succinct(const ArbreSuccinct *T1, const ArbreSuccinct *T2){
+    if (T1->n == 0) return true;
+    if (T2->n == 0) return false;
+    size_t taille = 0, capacite = 64;
+    PaireNoeuds *pile = (PaireNoeuds *)malloc(capacite * sizeof(PaireNoeuds));
+    if (pile == NULL){
+        perror("Erreur d'allocation dans Elagage_Succinct");
+        exit(EXIT_FAILURE);
+    }
+    pile[taille++] = (PaireNoeuds){0, 0};
+    bool resultat = true;
+    while (taille > 0 && resultat){
+        PaireNoeuds p = pile[--taille];
+        if (estFeuilleS(T1, p.i1)) continue;
+        if (couleur(T1, p.i1) != couleur(T2, p.i2)){ resultat = false; break; }
+        size_t fils1[2] = {filsDroit(T1, p.i1), filsGauche(T1, p.i1)};
+        size_t fils2[2] = {filsDroit(T2, p.i2), filsGauche(T2, p.i2)};
+        for (int c = 0; c < 2; c++){
+            if (fils1[c] == AUCUN) continue;           // Elagage(NULL, x) est vrai
+            if (fils2[c] == AUCUN){ resultat = false; break; }
+            if (taille == capacite){
+                capacite *= 2;
+                PaireNoeuds *nouvelle = (PaireNoeuds *)realloc(pile, capacite * sizeof(PaireNoeuds));
+                if (nouvelle == NULL){
+                    perror("Erreur d'allocation dans Elagage_Succinct");
+                    exit(EXIT_FAILURE);
+                }
+                pile = nouvelle;
+            }
+            pile[taille++] = (PaireNoeuds){fils1[c], fils2[c]};
+        }
+    }
+    free(pile);
+    return resultat;
+}
+
+// -------------------- Versions d'origine sur les pointeurs --------------------
+bool estFeuille(Arbre a){
+    return a != NULL && a->SAG == NULL && a->SAD == NULL;
+}
+
+bool Elagage(Arbre a1, Arbre a2){
+    if (a1 == NULL) return true;
+    if (a2 == NULL) return false;
+    if (estFeuille(a1)) return true;
+    if (a1->valeur != a2->valeur) return false;
+    return Elagage(a1->SAG, a2->SAG) && Elagage(a1->SAD, a2->SAD);
+}
+
+bool TOUTBLANC(Arbre a){
+    if (a == NULL) return true;
+    if (estFeuille(a)) return a->valeur == 1;
+    return TOUTBLANC(a->SAG) && TOUTBLANC(a->SAD);
+}
+
+void SIMPLIFIE(Arbre *a){
+    if (*a == NULL || estFeuille(*a)) return;
+    SIMPLIFIE(&((*a)->SAG));
+    SIMPLIFIE(&((*a)->SAD));
+    if (estFeuille((*a)->SAG) && estFeuille((*a)->SAD) && (*a)->SAG->valeur == (*a)->SAD->valeur){
+        int c = (*a)->SAG->valeur;
+        free((*a)->SAG);
+        free((*a)->SAD);
+        (*a)->SAG = (*a)->SAD = NULL;
+        (*a)->valeur = c;
+    }
+}
+
+// -------------------- Arbres de test --------------------
+Arbre creerNoeud(int v){
+    Arbre N = (Arbre)malloc(sizeof(Noeud));
+    if (N == NULL){
+        perror("Erreur d'allocation dans creerNoeud");
+        exit(EXIT_FAILURE);
+    }
+    N->valeur = v;
+    N->SAG = N->SAD = NULL;
+    return N;
+}
+
+void detruireArbre(Arbre A){
+    if (A == NULL) return;
+    detruireArbre(A->SAG);
+    detruireArbre(A->SAD);
+    free(A);
+}
+
+bool arbresEgaux(Arbre a, Arbre b){
+    if (a == NULL || b == NULL) return a == b;
+    return a->valeur == b->valeur && arbresEgaux(a->SAG, b->SAG) && arbresEgaux(a->SAD, b->SAD);
+}
+
+/*
+ * Image noir et blanc découpée en deux récursivement : une zone devient une
+ * feuille si elle est unie ou trop petite. L'image est un ensemble de disques
+ * sur fond blanc, de sorte que beaucoup de zones voisines ont la même couleur.
+ */
+typedef struct { double x, y, r; } Disque;
+
+int couleurPoint(const Disque *D, int nb, double x, double y){
+    for (int k = 0; k < nb; k++){
+        double dx = x - D[k].x, dy = y - D[k].y;
+        if (dx * dx + dy * dy < D[k].r * D[k].r) return 0;
+    }
+    return 1;
+}
+
+Arbre decouper(const Disque *D, int nb, double x0, double y0, double x1, double y1, int profondeur){
+    int coins = couleurPoint(D, nb, x0, y0) + couleurPoint(D, nb, x1, y0) +
+                couleurPoint(D, nb, x0, y1) + couleurPoint(D, nb, x1, y1) +
+                couleurPoint(D, nb, (x0 + x1) / 2, (y0 + y1) / 2);
+    if (profondeur == 0 || coins == 0 || coins == 5) return creerNoeud(coins >= 3);
+    Arbre A = creerNoeud(rand() & 1);
+    if (profondeur % 2 == 0){
+        double xm = (x0 + x1) / 2;
+        A->SAG = decouper(D, nb, x0, y0, xm, y1, profondeur - 1);
+        A->SAD = decouper(D, nb, xm, y0, x1, y1, profondeur - 1);
+    } else {
+        double ym = (y0 + y1) / 2;
+        A->SAG = decouper(D, nb, x0, y0, x1, ym, profondeur - 1);
+        A->SAD = decouper(D, nb, x0, ym, x1, y1, profondeur - 1);
+    }
+    return A;
+}
+
+// Toutes les feuilles deviennent blanches : TOUTBLANC doit alors tout parcourir
+void blanchir(Arbre A){
+    if (A == NULL) return;
+    if (estFeuille(A)) A->valeur = 1;
+    blanchir(A->SAG);
+    blanchir(A->SAD);
+}
+
+double secondes(clock_t debut){
+    return (double)(clock() - debut) / CLOCKS_PER_SEC;
+}
+
+// -------------------- Main pour tester --------------------
+int main(int argc, char *argv[]){
+    int profondeur = (argc > 1) ? atoi(argv[1]) : 34;
+    srand(5);
+    Disque D[40];
+    for (int k = 0; k < 40; k++) D[k] = (Disque){rand() / (double)RAND_MAX, rand() / (double)RAND_MAX, 0.02 + 0.1 * rand() / (double)RAND_MAX};
+    Arbre A = decouper(D, 40, 0, 0, 1, 1, profondeur);
+
+    // Codage, retour aux pointeurs, navigation
+    ArbreSuccinct T = encoderArbre(A);
+    Arbre B = decoderArbre(&T);
+    bool navigation = true;
+    for (size_t k = 1; k < T.n && navigation; k += 1 + T.n / 100000){
+        size_t p = pere(&T, k);
+        navigation = (filsGauche(&T, p) == k || filsDroit(&T, p) == k);
+    }
+    size_t octets_pointeurs = T.n * sizeof(Noeud), octets_succinct = octetsSuccinct(&T);
+    printf("Image de profondeur %d : %zu nœuds, décodage %s, navigation %s\n", profondeur, T.n,
+           arbresEgaux(A, B) ? "identique" : "différent", navigation ? "cohérente" : "incohérente");
+    printf("Mémoire : %zu octets en pointeurs (sans l'en-tête de malloc), %zu octets succincts "
+           "(%.2f bits par nœud, %.0f fois moins)\n", octets_pointeurs, octets_succinct,
+           8.0 * octets_succinct / T.n, (double)octets_pointeurs / octets_succinct);
+
+    // TOUTBLANC
+    clock_t t0 = clock();
+    bool tb = TOUTBLANC(A);
+    double d_pointeurs = secondes(t0);
+    t0 = clock();
+    bool tbs = TOUTBLANC_Succinct(&T);
+    printf("TOUTBLANC : %s / %s, pointeurs %.4f s, succinct %.4f s\n", tb ? "Vrai" : "Faux", tbs ? "Vrai" : "Faux",
+           d_pointeurs, secondes(t0));
+
+    // SIMPLIFIE : B est simplifié en place, T donne un nouveau codage
+    t0 = clock();
+    SIMPLIFIE(&B);
+    d_pointeurs = secondes(t0);
+    t0 = clock();
+    ArbreSuccinct S = SIMPLIFIE_Succinct(&T);
+    double d_succinct = secondes(t0);
+    Arbre C = decoderArbre(&S);
+    printf("SIMPLIFIE : %zu -> %zu nœuds, résultats %s, pointeurs %.4f s, succinct %.4f s\n", T.n, S.n,
+           arbresEgaux(B, C) ? "identiques" : "différents", d_pointeurs, d_succinct);
+
+    // Elagage : l'arbre simplifié est un élagage de l'arbre d'origine, l'inverse est faux
+    t0 = clock();
+    bool e1 = Elagage(B, A), e2 = Elagage(A, B);
+    d_pointeurs = secondes(t0);
+    t0 = clock();
+    bool s1 = Elagage_Succinct(&S, &T), s2 = Elagage_Succinct(&T, &S);
+    printf("Elagage(simplifié, origine) : %s / %s, Elagage(origine, simplifié) : %s / %s, "
+           "pointeurs %.4f s, succinct %.4f s\n", e1 ? "Vrai" : "Faux", s1 ? "Vrai" : "Faux",
+           e2 ? "Vrai" : "Faux", s2 ? "Vrai" : "Faux", d_pointeurs, secondes(t0));
+
+    // TOUTBLANC sur une image sans feuille noire : parcours complet
+    blanchir(A);
+    ArbreSuccinct W = encoderArbre(A);
+    t0 = clock();
+    tb = TOUTBLANC(A);
+    d_pointeurs = secondes(t0);
+    t0 = clock();
+    tbs = TOUTBLANC_Succinct(&W);
+    printf("TOUTBLANC (feuilles blanchies) : %s / %s, pointeurs %.4f s, succinct %.4f s\n",
+           tb ? "Vrai" : "Faux", tbs ? "Vrai" : "Faux", d_pointeurs, secondes(t0));
+
+    detruireArbre(A);
+    detruireArbre(B);
+    detruireArbre(C);
+    detruireSuccinct(&W);
+    detruireSuccinct(&T);
+    detruireSuccinct(&S);
+    return 0;
+}
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
+#include <time.h>
 
 /*
  * Portfolio GitHub - Arbres Binaires
@@ -8,7 +10,8 @@
  * Ce fichier contient des fonctions essentielles pour manipuler
  * des arbres binaires, incluant :
  * - Création et insertion de nœuds
- * - Parcours (itératif et récursif)
+ * - Parcours (itératif et récursif), pile contiguë sans allocation par nœud
+ * - Parcours avec visiteur, itérateur et écriture tamponnée des valeurs
  * - Comptage de nœuds selon différentes propriétés
  * - Vérification de propriétés de l'arbre (complet, miroir)
  * 
@@ -24,6 +27,8 @@ typedef struct Noeud {
 
 typedef Noeud *Arbre; // Arbre désigne la racine
 
+#include "Arene_Arbres.h"   // après Noeud : l'arène en dépend
+
 // -------------------- Fonctions utilitaires --------------------
 
 /**
@@ -41,25 +46,45 @@ int maximum(int a, int b){
 // -------------------- Création de nœuds --------------------
 
 /**
- * @brief Crée un nœud avec ses sous-arbres
+ * @brief Crée un nœud avec ses sous-arbres, pris dans une arène
+ * @param A L'arène (NULL pour une allocation par malloc)
  * @param G Sous-arbre gauche
  * @param D Sous-arbre droit
  * @param v Valeur du nœud
  * @return Arbre Nouveau nœud
- * Complexité : O(1)
+ * Complexité : O(1) amorti
  */
-Arbre creerNoeudAvecFils(Arbre G, Arbre D, int v){
-    Arbre tmp = (Arbre)malloc(sizeof(Noeud));
-    if(tmp == NULL){
-        perror("Erreur d'allocation mémoire"); 
-        exit(EXIT_FAILURE);
-    }
+Arbre creerNoeudAvecFils_Arene(Arene *A, Arbre G, Arbre D, int v){
+    Arbre tmp = nouveauNoeud(A);
     tmp->valeur = v;
     tmp->SAG = G;
     tmp->SAD = D;
     return tmp;
 }
 
+/**
+ * @brief Crée un nœud avec ses sous-arbres
+ * @param G Sous-arbre gauche
+ * @param D Sous-arbre droit
+ * @param v Valeur du nœud
+ * @return Arbre Nouveau nœud
+ * Complexité : O(1)
+ */
+Arbre creerNoeudAvecFils(Arbre G, Arbre D, int v){
+    return creerNoeudAvecFils_Arene(NULL, G, D, v);
+}
+
+/**
+ * @brief Crée une feuille dans une arène
+ * @param A L'arène (NULL pour une allocation par malloc)
+ * @param v Valeur du nœud
+ * @return Arbre Nouveau nœud feuille
+ * Complexité : O(1) amorti
+ */
+Arbre creerNoeudSimple_Arene(Arene *A, int v){
+    return creerNoeudAvecFils_Arene(A, NULL, NULL, v);
+}
+
 /**
  * @brief Crée un nœud sans fils (feuille)
  * @param v Valeur du nœud
@@ -126,14 +151,48 @@ bool SontMiroirs(Arbre A1, Arbre A2){
 }
 
 // -------------------- Implémentation d'une pile --------------------
-typedef struct ElementPile{
-    Arbre ptr; 
-    struct ElementPile *suivant; 
-} ElementPile; 
+/*
+ * Pile contiguë : les pointeurs sont rangés dans un tableau dont la capacité
+ * double quand il est plein. Aucune allocation par empiler / depiler.
+ * L'appelant peut fournir un tampon (par exemple un tableau local) : aucune
+ * allocation n'a lieu tant que la profondeur ne dépasse pas sa capacité.
+ */
+#define CAPACITE_PILE_INITIALE 16
+#define CAPACITE_TAMPON_LOCAL 64   // suffit pour tout arbre équilibré de moins de 2^63 nœuds
 
 typedef struct {
-    ElementPile *sommet; 
-} Pile; 
+    Arbre *elements;      // tableau des pointeurs empilés
+    size_t taille;        // nombre d'éléments
+    size_t capacite;      // nombre de cases du tableau
+    bool tampon_externe;  // elements appartient à l'appelant (jamais libéré ici)
+} Pile;
+
+/**
+ * @brief Initialise une pile sur un tampon fourni (ou vide si tampon == NULL)
+ * @param P La pile
+ * @param tampon Tableau de l'appelant, peut être NULL
+ * @param capacite Nombre de cases du tampon
+ * Complexité : O(1)
+ */
+void initialiser_pile(Pile *P, Arbre *tampon, size_t capacite){
+    P->elements = tampon;
+    P->taille = 0;
+    P->capacite = (tampon != NULL) ? capacite : 0;
+    P->tampon_externe = (tampon != NULL);
+}
+
+/**
+ * @brief Libère le tableau de la pile s'il a été alloué par la pile
+ * @param P La pile
+ * Complexité : O(1)
+ */
+void liberer_pile(Pile *P){
+    if (!P->tampon_externe) free(P->elements);
+    P->elements = NULL;
+    P->taille = 0;
+    P->capacite = 0;
+    P->tampon_externe = false;
+}
 
 Pile *creer_pile(){
     Pile *P = (Pile*)malloc(sizeof(Pile)); 
@@ -141,32 +200,323 @@ Pile *creer_pile(){
         perror("Erreur d'allocation pile");
         exit(EXIT_FAILURE);
     }
-    P->sommet = NULL;
+    initialiser_pile(P, NULL, 0);
     return P;
 }
 
+void detruire_pile(Pile *P){
+    liberer_pile(P);
+    free(P);
+}
+
 bool estVide(Pile *P){
-    return P->sommet == NULL;
+    return P->taille == 0;
 }
 
-void empiler(Pile *P, Arbre racine){
-    ElementPile *nouvel_element = (ElementPile*)malloc(sizeof(ElementPile)); 
-    if(nouvel_element == NULL){
-        perror("Erreur d'allocation ElementPile");
+/**
+ * @brief Double la capacité de la pile (le tampon externe est recopié)
+ * @param P La pile
+ * Complexité : O(taille)
+ */
+void agrandir_pile(Pile *P){
+    size_t capacite = (P->capacite == 0) ? CAPACITE_PILE_INITIALE : 2 * P->capacite;
+    Arbre *elements;
+    if (P->tampon_externe){
+        elements = (Arbre*)malloc(capacite * sizeof(Arbre));
+        if (elements != NULL) memcpy(elements, P->elements, P->taille * sizeof(Arbre));
+    } else {
+        elements = (Arbre*)realloc(P->elements, capacite * sizeof(Arbre));
+    }
+    if(elements == NULL){
+        perror("Erreur d'allocation pile");
         exit(EXIT_FAILURE);
     }
-    nouvel_element->ptr = racine;
-    nouvel_element->suivant = P->sommet;
-    P->sommet = nouvel_element;
+    P->elements = elements;
+    P->capacite = capacite;
+    P->tampon_externe = false;
 }
 
+// Complexité : O(1) amorti
+void empiler(Pile *P, Arbre racine){
+    if (P->taille == P->capacite) agrandir_pile(P);
+    P->elements[P->taille++] = racine;
+}
+
+// Complexité : O(1)
 Arbre depiler(Pile *P){
     if(estVide(P)) return NULL;
-    ElementPile *tmp = P->sommet; 
-    Arbre racine = tmp->ptr;
-    P->sommet = tmp->suivant; 
-    free(tmp); 
-    return racine;
+    return P->elements[--P->taille];
+}
+
+// -------------------- Parcours itératifs --------------------
+/*
+ * Les parcours suivants appellent visiteur(noeud, ctx) sur chaque nœud et
+ * renvoient le nombre de nœuds visités. Ils n'utilisent pas la récursion :
+ * un arbre dégénéré (liste) de plusieurs millions de nœuds ne fait pas
+ * déborder la pile d'appels.
+ */
+typedef void (*Visiteur)(Arbre noeud, void *ctx);
+
+/**
+ * @brief Parcours préfixe itératif
+ * @param racine Racine de l'arbre
+ * @param visiteur Fonction appelée sur chaque nœud
+ * @param ctx Contexte transmis au visiteur
+ * @return size_t Nombre de nœuds visités
+ * Complexité : O(n)
+ */
+size_t ParcoursPrefixe(Arbre racine, Visiteur visiteur, void *ctx){
+    size_t k = 0;
+    if(racine == NULL) return 0;
+    Arbre tampon[CAPACITE_TAMPON_LOCAL];
+    Pile pile;
+    initialiser_pile(&pile, tampon, CAPACITE_TAMPON_LOCAL);
+    empiler(&pile, racine);
+
+    while(!estVide(&pile)){
+        Arbre X = depiler(&pile);
+        visiteur(X, ctx);
+        k++;
+        if(X->SAD) empiler(&pile, X->SAD);
+        if(X->SAG) empiler(&pile, X->SAG);
+    }
+    liberer_pile(&pile);
+    return k;
+}
+
+/**
+ * @brief Parcours infixe itératif
+ * @param racine Racine de l'arbre
+ * @param visiteur Fonction appelée sur chaque nœud
+ * @param ctx Contexte transmis au visiteur
+ * @return size_t Nombre de nœuds visités
+ * Complexité : O(n)
+ */
+size_t ParcoursInfixe(Arbre racine, Visiteur visiteur, void *ctx){
+    size_t k = 0;
+    Arbre tampon[CAPACITE_TAMPON_LOCAL];
+    Pile pile;
+    initialiser_pile(&pile, tampon, CAPACITE_TAMPON_LOCAL);
+    Arbre courant = racine;
+
+    while(courant != NULL || !estVide(&pile)){
+        while(courant != NULL){        // descente à gauche
+            empiler(&pile, courant);
+            courant = courant->SAG;
+        }
+        courant = depiler(&pile);
+        visiteur(courant, ctx);
+        k++;
+        courant = courant->SAD;
+    }
+    liberer_pile(&pile);
+    return k;
+}
+
+/**
+ * @brief Parcours suffixe itératif (une seule pile)
+ * @param racine Racine de l'arbre
+ * @param visiteur Fonction appelée sur chaque nœud
+ * @param ctx Contexte transmis au visiteur
+ * @return size_t Nombre de nœuds visités
+ * Complexité : O(n)
+ */
+size_t ParcoursSuffixe(Arbre racine, Visiteur visiteur, void *ctx){
+    size_t k = 0;
+    Arbre tampon[CAPACITE_TAMPON_LOCAL];
+    Pile pile;
+    initialiser_pile(&pile, tampon, CAPACITE_TAMPON_LOCAL);
+    Arbre courant = racine;
+    Arbre dernier = NULL;   // dernier nœud visité
+
+    while(courant != NULL || !estVide(&pile)){
+        while(courant != NULL){
+            empiler(&pile, courant);
+            courant = courant->SAG;
+        }
+        Arbre X = pile.elements[pile.taille - 1];
+        if(X->SAD != NULL && X->SAD != dernier){
+            courant = X->SAD;           // le sous-arbre droit n'est pas encore visité
+        } else {
+            visiteur(X, ctx);
+            k++;
+            dernier = depiler(&pile);
+        }
+    }
+    liberer_pile(&pile);
+    return k;
+}
+
+/**
+ * @brief Parcours en largeur (niveau par niveau) : deux tableaux contigus,
+ *        le niveau courant et le suivant, sont échangés à chaque étage
+ * @param racine Racine de l'arbre
+ * @param visiteur Fonction appelée sur chaque nœud
+ * @param ctx Contexte transmis au visiteur
+ * @return size_t Nombre de nœuds visités
+ * Complexité : O(n)
+ */
+size_t ParcoursLargeur(Arbre racine, Visiteur visiteur, void *ctx){
+    size_t k = 0;
+    if(racine == NULL) return 0;
+    Arbre tamponA[CAPACITE_TAMPON_LOCAL], tamponB[CAPACITE_TAMPON_LOCAL];
+    Pile niveau, suivant;
+    initialiser_pile(&niveau, tamponA, CAPACITE_TAMPON_LOCAL);
+    initialiser_pile(&suivant, tamponB, CAPACITE_TAMPON_LOCAL);
+    empiler(&niveau, racine);
+
+    while(!estVide(&niveau)){
+        for(size_t i = 0; i < niveau.taille; i++){
+            Arbre X = niveau.elements[i];
+            visiteur(X, ctx);
+            k++;
+            if(X->SAG) empiler(&suivant, X->SAG);
+            if(X->SAD) empiler(&suivant, X->SAD);
+        }
+        Pile tmp = niveau;
+        niveau = suivant;
+        suivant = tmp;
+        suivant.taille = 0;
+    }
+    liberer_pile(&niveau);
+    liberer_pile(&suivant);
+    return k;
+}
+
+// -------------------- Itérateur (parcours à la demande) --------------------
+typedef enum { PREFIXE, INFIXE, SUFFIXE } Ordre;
+
+typedef struct {
+    Ordre ordre;
+    Pile pile;
+    Arbre courant;     // prochain sous-arbre à descendre (infixe, suffixe)
+    Arbre dernier;     // dernier nœud rendu (suffixe)
+    Arbre tampon[CAPACITE_TAMPON_LOCAL];
+} Iterateur;
+
+/**
+ * @brief Prépare un parcours de l'arbre dans l'ordre demandé
+ * @param it L'itérateur (peut être une variable locale)
+ * @param racine Racine de l'arbre
+ * @param ordre PREFIXE, INFIXE ou SUFFIXE
+ * Complexité : O(1)
+ */
+void initialiser_iterateur(Iterateur *it, Arbre racine, Ordre ordre){
+    it->ordre = ordre;
+    initialiser_pile(&it->pile, it->tampon, CAPACITE_TAMPON_LOCAL);
+    it->courant = NULL;
+    it->dernier = NULL;
+    if(ordre == PREFIXE){
+        if(racine) empiler(&it->pile, racine);
+    } else {
+        it->courant = racine;
+    }
+}
+
+/**
+ * @brief Renvoie le nœud suivant du parcours, NULL à la fin
+ * @param it L'itérateur
+ * @return Arbre Le nœud suivant
+ * Complexité : O(1) amorti, O(n) pour tout le parcours
+ */
+Arbre suivant(Iterateur *it){
+    if(it->ordre == PREFIXE){
+        Arbre X = depiler(&it->pile);
+        if(X == NULL) return NULL;
+        if(X->SAD) empiler(&it->pile, X->SAD);
+        if(X->SAG) empiler(&it->pile, X->SAG);
+        return X;
+    }
+    if(it->ordre == INFIXE){
+        while(it->courant != NULL){
+            empiler(&it->pile, it->courant);
+            it->courant = it->courant->SAG;
+        }
+        Arbre X = depiler(&it->pile);
+        if(X != NULL) it->courant = X->SAD;
+        return X;
+    }
+    for(;;){   // SUFFIXE
+        while(it->courant != NULL){
+            empiler(&it->pile, it->courant);
+            it->courant = it->courant->SAG;
+        }
+        if(estVide(&it->pile)) return NULL;
+        Arbre X = it->pile.elements[it->pile.taille - 1];
+        if(X->SAD != NULL && X->SAD != it->dernier){
+            it->courant = X->SAD;
+        } else {
+            it->dernier = depiler(&it->pile);
+            return X;
+        }
+    }
+}
+
+// Libère la pile si elle a débordé du tampon interne
+// (la pile pointe sur ce tampon : un Iterateur ne doit pas être copié)
+void liberer_iterateur(Iterateur *it){
+    liberer_pile(&it->pile);
+}
+
+// -------------------- Écriture tamponnée des valeurs --------------------
+/*
+ * Un appel à printf par nœud coûte bien plus cher que la visite elle-même.
+ * TamponSortie formate les entiers à la main dans un grand tableau et
+ * n'appelle fwrite que lorsqu'il est plein.
+ */
+#define TAILLE_TAMPON_SORTIE (1 << 16)
+
+typedef struct {
+    FILE *flux;
+    size_t position;
+    char octets[TAILLE_TAMPON_SORTIE];
+} TamponSortie;
+
+void initialiser_tampon(TamponSortie *T, FILE *flux){
+    T->flux = flux;
+    T->position = 0;
+}
+
+// Écrit le contenu du tampon dans le flux
+// Complexité : O(taille du tampon)
+void vider_tampon(TamponSortie *T){
+    if(T->position > 0) fwrite(T->octets, 1, T->position, T->flux);
+    T->position = 0;
+}
+
+/**
+ * @brief Ajoute v suivi d'un séparateur au tampon
+ * @param T Le tampon
+ * @param v L'entier à écrire
+ * @param separateur Caractère écrit après v
+ * Complexité : O(nombre de chiffres)
+ */
+void ecrire_entier(TamponSortie *T, int v, char separateur){
+    if(T->position + 13 > TAILLE_TAMPON_SORTIE) vider_tampon(T);   // signe + 10 chiffres + séparateur
+    char chiffres[10];
+    int nb = 0;
+    unsigned int u = (v < 0) ? 0u - (unsigned int)v : (unsigned int)v;
+    do {
+        chiffres[nb++] = (char)('0' + u % 10);
+        u /= 10;
+    } while(u != 0);
+    if(v < 0) T->octets[T->position++] = '-';
+    while(nb > 0) T->octets[T->position++] = chiffres[--nb];
+    T->octets[T->position++] = separateur;
+}
+
+// Ajoute une chaîne au tampon
+// Complexité : O(longueur)
+void ecrire_texte(TamponSortie *T, const char *texte){
+    for(; *texte != '\0'; texte++){
+        if(T->position == TAILLE_TAMPON_SORTIE) vider_tampon(T);
+        T->octets[T->position++] = *texte;
+    }
+}
+
+// Visiteur qui écrit la valeur du nœud dans un TamponSortie (ctx)
+void visiteur_ecrire(Arbre noeud, void *ctx){
+    ecrire_entier((TamponSortie*)ctx, noeud->valeur, ' ');
 }
 
 // -------------------- Affichage préfixe itératif --------------------
@@ -177,16 +527,13 @@ Arbre depiler(Pile *P){
  */
 void AffichagePrefixe(Arbre racine){
     if(racine == NULL) return;
-    Pile *pile = creer_pile();
-    empiler(pile, racine);
-
-    while(!estVide(pile)){
-        Arbre X = depiler(pile);
-        printf("%d ", X->valeur);
-        if(X->SAD) empiler(pile, X->SAD);
-        if(X->SAG) empiler(pile, X->SAG);
-    }
-    printf("\n");
+    TamponSortie T;   // local : la fonction reste réentrante et tout est écrit avant le retour
+    fflush(stdout);
+    initialiser_tampon(&T, stdout);
+    ParcoursPrefixe(racine, visiteur_ecrire, &T);
+    ecrire_texte(&T, "\n");
+    vider_tampon(&T);
+    fflush(stdout);
 }
 
 // -------------------- Fonctions de comptage --------------------
@@ -246,5 +593,53 @@ int main() {
     printf("Affichage Prefixe: ");
     AffichagePrefixe(racine);
 
+    static TamponSortie T;
+    initialiser_tampon(&T, stdout);
+    const char *noms[] = {"Prefixe", "Infixe", "Suffixe", "Largeur"};
+    size_t (*parcours[])(Arbre, Visiteur, void *) = {ParcoursPrefixe, ParcoursInfixe, ParcoursSuffixe, ParcoursLargeur};
+    fflush(stdout);
+    for(int p = 0; p < 4; p++){
+        ecrire_texte(&T, noms[p]);
+        ecrire_texte(&T, ": ");
+        parcours[p](racine, visiteur_ecrire, &T);
+        ecrire_texte(&T, "\n");
+    }
+    vider_tampon(&T);
+
+    Iterateur it;
+    initialiser_iterateur(&it, racine, SUFFIXE);
+    printf("Iterateur suffixe: ");
+    for(Arbre X = suivant(&it); X != NULL; X = suivant(&it)) printf("%d ", X->valeur);
+    printf("\n");
+    liberer_iterateur(&it);
+
+    // Arbre dégénéré (peigne gauche) : aucun débordement de la pile d'appels.
+    // Ses nœuds sont pris dans une arène : contigus, et libérés d'un seul coup
+    size_t taille = 1000000;
+    Arene *arene = creerArene(taille);
+    Arbre peigne = NULL;
+    for(size_t i = 0; i < taille; i++) peigne = creerNoeudAvecFils_Arene(arene, peigne, NULL, (int)i);
+
+    // Écriture du peigne dans un fichier temporaire : printf par nœud puis tampon
+    FILE *f = tmpfile();
+    if(f == NULL){
+        perror("Erreur tmpfile");
+        exit(EXIT_FAILURE);
+    }
+    clock_t t0 = clock();
+    initialiser_iterateur(&it, peigne, INFIXE);
+    for(Arbre X = suivant(&it); X != NULL; X = suivant(&it)) fprintf(f, "%d ", X->valeur);
+    liberer_iterateur(&it);
+    clock_t t1 = clock();
+    initialiser_tampon(&T, f);
+    size_t n = ParcoursSuffixe(peigne, visiteur_ecrire, &T);
+    vider_tampon(&T);
+    clock_t t2 = clock();
+    printf("Peigne de %zu noeuds : fprintf %.3f s, tampon %.3f s\n", n,
+           (double)(t1 - t0) / CLOCKS_PER_SEC, (double)(t2 - t1) / CLOCKS_PER_SEC);
+    fclose(f);
+
+    detruireArene(arene);
+
     return 0;
 }
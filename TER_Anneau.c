@@ -0,0 +1,373 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * File FIFO en tableau circulaire (anneau)
+ *
+ * Même sémantique que la file de TER.c (entree ajoute en fin, sortie retire
+ * en tête) mais les valeurs sont rangées dans un tableau contigu dont la
+ * capacité est une puissance de deux : la position d'une case s'obtient par
+ * un masque au lieu d'un modulo, et aucune allocation n'a lieu par élément.
+ * - File extensible : la capacité double quand le tableau est plein.
+ * - File de capacité fixe : essayerEntree refuse l'élément quand elle est pleine.
+ * - entree_batch / sortie_batch déplacent des suites entières d'éléments en au
+ *   plus deux memcpy (une seule vérification de place par lot).
+ *
+ * Le main compare cette file à la file chaînée de TER.c, et les opérations par
+ * lots aux opérations élément par élément.
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+// -------------------- Structures --------------------
+typedef struct {
+    int *valeurs;        // tableau circulaire
+    size_t capacite;     // puissance de deux
+    size_t tete;         // nombre total de sorties (la case est tete & (capacite - 1))
+    size_t queue;        // nombre total d'entrées (la case est queue & (capacite - 1))
+    bool extensible;     // la capacité double quand la file est pleine
+} FileAnneau;
+
+// -------------------- Fonctions --------------------
+
+// Plus petite puissance de deux >= n (au moins 1)
+// Complexité : O(log n)
+size_t puissanceDeDeux(size_t n){
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+/*
+ * @brief Crée une file vide
+ * @param capacite Capacité initiale (arrondie à une puissance de deux)
+ * @param extensible true pour doubler la capacité quand la file est pleine
+ * @return FileAnneau* La nouvelle file
+ * Complexité : O(1)
+ */
+FileAnneau *creerFileAnneau(size_t capacite, bool extensible){
+    FileAnneau *F = (FileAnneau *)malloc(sizeof(FileAnneau));
+    if (F == NULL){
+        perror("Erreur d'allocation pour creerFileAnneau");
+        exit(EXIT_FAILURE);
+    }
+    F->capacite = puissanceDeDeux(capacite);
+    F->valeurs = (int *)malloc(F->capacite * sizeof(int));
+    if (F->valeurs == NULL){
+        perror("Erreur d'allocation pour creerFileAnneau");
+        exit(EXIT_FAILURE);
+    }
+    F->tete = 0;
+    F->queue = 0;
+    F->extensible = extensible;
+    return F;
+}
+
+void detruireFileAnneau(FileAnneau *F){
+    free(F->valeurs);
+    free(F);
+}
+
+// Nombre d'éléments de la file
+// Complexité : O(1)
+size_t tailleFile(const FileAnneau *F){
+    return F->queue - F->tete;
+}
+
+bool estVideFile(const FileAnneau *F){
+    return F->queue == F->tete;
+}
+
+/*
+ * @brief Copie n éléments à partir du rang donné, en au plus deux memcpy
+ *        (la partie contiguë jusqu'à la fin du tableau, puis le début)
+ * @param F La file
+ * @param rang Rang du premier élément (entre tete et queue)
+ * @param x Tableau destination
+ * @param n Nombre d'éléments à copier (au plus queue - rang)
+ * Complexité : O(n)
+ */
+void copierDepuisFile(const FileAnneau *F, size_t rang, int *x, size_t n){
+    size_t debut = rang & (F->capacite - 1);
+    size_t premier_morceau = F->capacite - debut;
+    if (premier_morceau > n) premier_morceau = n;
+    memcpy(x, F->valeurs + debut, premier_morceau * sizeof(int));
+    memcpy(x + premier_morceau, F->valeurs, (n - premier_morceau) * sizeof(int));
+}
+
+/*
+ * @brief Double la capacité ; les éléments sont recopiés dans l'ordre,
+ *        la tête revenant en case 0
+ * @param F La file
+ * Complexité : O(n)
+ */
+void agrandirFile(FileAnneau *F){
+    size_t n = tailleFile(F);
+    size_t capacite = 2 * F->capacite;
+    int *valeurs = (int *)malloc(capacite * sizeof(int));
+    if (valeurs == NULL){
+        perror("Erreur d'allocation pour agrandirFile");
+        exit(EXIT_FAILURE);
+    }
+    copierDepuisFile(F, F->tete, valeurs, n);
+    free(F->valeurs);
+    F->valeurs = valeurs;
+    F->capacite = capacite;
+    F->tete = 0;
+    F->queue = n;
+}
+
+/*
+ * @brief Ajoute un élément si la place le permet (ou si la file est extensible)
+ * @param x Valeur à insérer
+ * @param F La file
+ * @return true si l'élément a été ajouté, false si la file fixe est pleine
+ * Complexité : O(1) amorti
+ */
+bool essayerEntree(int x, FileAnneau *F){
+    if (tailleFile(F) == F->capacite){
+        if (!F->extensible) return false;
+        agrandirFile(F);
+    }
+    F->valeurs[F->queue & (F->capacite - 1)] = x;
+    F->queue++;
+    return true;
+}
+
+/*
+ * @brief Ajoute un élément à la fin de la file (enqueue)
+ * @param x Valeur à insérer
+ * @param F La file
+ * Complexité : O(1) amorti
+ */
+void entree(int x, FileAnneau *F){
+    if (!essayerEntree(x, F)){
+        perror("Erreur : tentative d'entree sur une file pleine.");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*
+ * @brief Retire l'élément de la tête de la file (dequeue)
+ * @param x Pointeur pour stocker la valeur retirée
+ * @param F La file
+ * Complexité : O(1)
+ */
+void sortie(int *x, FileAnneau *F){
+    if (estVideFile(F)){
+        perror("Erreur : tentative de sortie sur une file vide.");
+        exit(EXIT_FAILURE);
+    }
+    *x = F->valeurs[F->tete & (F->capacite - 1)];
+    F->tete++;
+}
+
+/*
+ * @brief Ajoute n éléments à la fin de la file en une seule opération
+ * @param x Valeurs à insérer, dans l'ordre
+ * @param n Nombre de valeurs
+ * @param F La file
+ * @return size_t Nombre de valeurs ajoutées (moins de n si la file fixe se remplit)
+ * Complexité : O(n) ; une seule vérification de place et au plus deux memcpy
+ */
+size_t entree_batch(const int *x, size_t n, FileAnneau *F){
+    size_t libre = F->capacite - tailleFile(F);
+    if (n > libre){
+        if (F->extensible){
+            while (F->capacite - tailleFile(F) < n) agrandirFile(F);
+        } else {
+            n = libre;
+        }
+    }
+    size_t debut = F->queue & (F->capacite - 1);
+    size_t premier_morceau = F->capacite - debut;
+    if (premier_morceau > n) premier_morceau = n;
+    memcpy(F->valeurs + debut, x, premier_morceau * sizeof(int));
+    memcpy(F->valeurs, x + premier_morceau, (n - premier_morceau) * sizeof(int));
+    F->queue += n;
+    return n;
+}
+
+/*
+ * @brief Retire jusqu'à max éléments de la tête de la file
+ * @param x Tableau recevant les valeurs retirées, dans l'ordre
+ * @param max Capacité du tableau
+ * @param F La file
+ * @return size_t Nombre de valeurs retirées (0 si la file est vide)
+ * Complexité : O(max) ; au plus deux memcpy
+ */
+size_t sortie_batch(int *x, size_t max, FileAnneau *F){
+    size_t n = tailleFile(F);
+    if (n > max) n = max;
+    copierDepuisFile(F, F->tete, x, n);
+    F->tete += n;
+    return n;
+}
+
+// Écrit l'entier v suivi d'une espace dans p, renvoie le nombre de caractères
+// Complexité : O(nombre de chiffres)
+size_t formaterEntier(char *p, int v){
+    char chiffres[12];
+    size_t k = 0, n = 0;
+    unsigned int u = (v < 0) ? 0u - (unsigned int)v : (unsigned int)v;
+    if (v < 0) p[n++] = '-';
+    do { chiffres[k++] = (char)('0' + u % 10); u /= 10; } while (u != 0);
+    while (k > 0) p[n++] = chiffres[--k];
+    p[n++] = ' ';
+    return n;
+}
+
+#define LOT_AFFICHAGE 256
+
+/*
+ * @brief Affiche tous les éléments de la file sans la modifier
+ *        Les valeurs sont lues par lots dans un tableau local, formatées dans
+ *        un tampon de texte et écrites en un seul fwrite par lot.
+ * @param F La file
+ * Complexité : O(n)
+ */
+void afficherFile(const FileAnneau *F){
+    if (estVideFile(F)){
+        printf("File vide\n");
+        return;
+    }
+    int lot[LOT_AFFICHAGE];
+    char texte[LOT_AFFICHAGE * 12 + 1];
+    for (size_t rang = F->tete; rang != F->queue; ){
+        size_t n = F->queue - rang;
+        if (n > LOT_AFFICHAGE) n = LOT_AFFICHAGE;
+        copierDepuisFile(F, rang, lot, n);
+        rang += n;
+        size_t longueur = 0;
+        for (size_t i = 0; i < n; i++) longueur += formaterEntier(texte + longueur, lot[i]);
+        if (rang == F->queue) texte[longueur++] = '\n';
+        fwrite(texte, 1, longueur, stdout);
+    }
+}
+
+// -------------------- File chaînée de TER.c (référence) --------------------
+typedef struct Bloc {
+    int valeur;
+    struct Bloc *suivant;
+} Bloc;
+
+typedef Bloc *File;  // Pointeur vers le dernier élément de la file
+
+void entreeChainee(int x, File *F_ptr){
+    File F = *F_ptr;
+    Bloc *N = (Bloc *)malloc(sizeof(Bloc));
+    if (N == NULL){
+        perror("Erreur d'allocation pour entreeChainee");
+        exit(EXIT_FAILURE);
+    }
+    N->valeur = x;
+    if (F == NULL){
+        N->suivant = N;
+    } else {
+        N->suivant = F->suivant;
+        F->suivant = N;
+    }
+    *F_ptr = N;
+}
+
+void sortieChainee(int *x, File *F_ptr){
+    File F = *F_ptr;
+    Bloc *H = F->suivant;
+    *x = H->valeur;
+    if (F == H){
+        *F_ptr = NULL;
+    } else {
+        F->suivant = H->suivant;
+    }
+    free(H);
+}
+
+// -------------------- Main pour tester --------------------
+double secondes(clock_t debut, clock_t fin){
+    return (double)(fin - debut) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[]){
+    FileAnneau *F = creerFileAnneau(2, true);
+    int valeurSortie;
+
+    printf("Enqueue 10, 20, 30\n");
+    entree(10, F);
+    entree(20, F);
+    entree(30, F);
+    printf("Etat de la file : ");
+    afficherFile(F);
+
+    sortie(&valeurSortie, F);
+    printf("Valeur sortie : %d\n", valeurSortie);
+    sortie(&valeurSortie, F);
+    printf("Valeur sortie : %d\n", valeurSortie);
+    printf("Etat final de la file : ");
+    afficherFile(F);
+    detruireFileAnneau(F);
+
+    // File de capacité fixe : le cinquième élément est refusé
+    F = creerFileAnneau(4, false);
+    int acceptes = 0;
+    for (int i = 0; i < 5; i++) acceptes += essayerEntree(i, F);
+    printf("File fixe de capacité 4 : %d éléments acceptés sur 5\n", acceptes);
+    sortie(&valeurSortie, F);
+    int suite[] = {100, 101, 102};
+    printf("Batch de 3 après une sortie : %zu acceptés, file : ", entree_batch(suite, 3, F));
+    afficherFile(F);
+    int retires[8];
+    size_t nb = sortie_batch(retires, 8, F);
+    printf("sortie_batch : %zu valeurs, la dernière vaut %d\n", nb, retires[nb - 1]);
+    detruireFileAnneau(F);
+
+    // Banc d'essai : n entrées puis n sorties, puis n entrée/sortie alternées
+    long n = (argc > 1) ? atol(argv[1]) : 10000000;
+    long long somme_chainee = 0, somme_anneau = 0;
+    File racine = NULL;
+    F = creerFileAnneau(16, true);
+
+    clock_t t0 = clock();
+    for (long i = 0; i < n; i++) entreeChainee((int)i, &racine);
+    for (long i = 0; i < n; i++){ sortieChainee(&valeurSortie, &racine); somme_chainee += valeurSortie; }
+    for (long i = 0; i < n; i++){
+        entreeChainee((int)i, &racine);
+        sortieChainee(&valeurSortie, &racine);
+        somme_chainee += valeurSortie;
+    }
+    clock_t t1 = clock();
+    for (long i = 0; i < n; i++) entree((int)i, F);
+    for (long i = 0; i < n; i++){ sortie(&valeurSortie, F); somme_anneau += valeurSortie; }
+    for (long i = 0; i < n; i++){
+        entree((int)i, F);
+        sortie(&valeurSortie, F);
+        somme_anneau += valeurSortie;
+    }
+    clock_t t2 = clock();
+
+    printf("%ld entrées/sorties en rafale puis %ld alternées :\n", n, n);
+    printf("  file chaînée %.3f s, anneau %.3f s (résultats %s)\n",
+           secondes(t0, t1), secondes(t1, t2), somme_chainee == somme_anneau ? "identiques" : "différents");
+
+    // Même rafale par lots de LOT éléments
+    enum { LOT = 1024 };
+    int lot[LOT];
+    long long somme_lots = 0;
+    clock_t t3 = clock();
+    for (long i = 0; i < n; i += LOT){
+        size_t k = (n - i < LOT) ? (size_t)(n - i) : LOT;
+        for (size_t j = 0; j < k; j++) lot[j] = (int)(i + (long)j);
+        entree_batch(lot, k, F);
+    }
+    for (size_t k; (k = sortie_batch(lot, LOT, F)) > 0; ){
+        for (size_t j = 0; j < k; j++) somme_lots += lot[j];
+    }
+    clock_t t4 = clock();
+    printf("%ld entrées puis sorties par lots de %d : %.3f s (somme %s)\n", n, LOT,
+           secondes(t3, t4), 2 * somme_lots == somme_anneau ? "identique" : "différente");
+
+    detruireFileAnneau(F);
+    return 0;
+}
@@ -0,0 +1,437 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+/*
+ * File FIFO bornée bloquante (producteurs / consommateurs)
+ *
+ * Dans TER.c, sortie sur une file vide termine le programme : un thread qui
+ * attend des données doit boucler ou dormir par intervalles. Ici :
+ * - sortie attend qu'un élément arrive, entree attend qu'une place se libère ;
+ *   sortieAvecDelai / entreeAvecDelai abandonnent après un délai ;
+ * - le chemin rapide est la file MPMC sans verrou de TER_MPMC.c (cases
+ *   numérotées, réservation par compare-and-swap) : sans attente, aucun appel
+ *   système n'est fait ;
+ * - un thread qui ne trouve rien tourne d'abord un court moment (la durée
+ *   s'adapte selon que l'attente active a réussi ou non), puis s'endort sur un
+ *   futex. Il ne consomme alors plus de processeur ;
+ * - un réveil n'est envoyé que sur les transitions vide -> non vide et
+ *   pleine -> non pleine, et seulement si quelqu'un dort. Le thread réveillé
+ *   réveille le suivant s'il reste du travail (réveil en relais), ce qui évite
+ *   un appel système par élément.
+ *
+ * Spécifique à Linux (futex). Compilation : gcc -O2 -pthread TER_Bloquante.c
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+#define LIGNE_CACHE 64
+#define SPIN_MIN 8
+#define SPIN_MAX 4096
+
+#if defined(__x86_64__) || defined(__i386__)
+#define PAUSE() __builtin_ia32_pause()
+#else
+#define PAUSE() ((void)0)
+#endif
+
+// -------------------- Structures --------------------
+typedef struct {
+    atomic_size_t sequence;
+    int valeur;
+} Case;
+
+// Un côté de la file : les threads qui attendent des éléments, ou de la place
+typedef struct {
+    alignas(LIGNE_CACHE) atomic_uint evenements;     // mot futex, incrémenté à chaque réveil
+    atomic_uint_least64_t dormeurs;                  // 32 bits bas : threads endormis,
+                                                     // 32 bits hauts : réveils envoyés pas encore reçus
+    atomic_uint spin;                                // durée actuelle d'attente active
+} Attente;
+
+typedef struct {
+    Case *cases;
+    size_t masque;
+    alignas(LIGNE_CACHE) atomic_size_t queue;
+    alignas(LIGNE_CACHE) atomic_size_t tete;
+    Attente non_vide;                                // consommateurs en attente
+    Attente non_pleine;                              // producteurs en attente
+    atomic_ulong appels_attente;                     // statistiques : appels futex
+    atomic_ulong appels_reveil;
+} FileBloquante;
+
+// -------------------- Futex --------------------
+static long futex(atomic_uint *mot, int operation, unsigned int valeur, const struct timespec *delai){
+    return syscall(SYS_futex, (unsigned int *)mot, operation, valeur, delai, NULL, 0);
+}
+
+// -------------------- Fonctions --------------------
+
+size_t puissanceDeDeux(size_t n){
+    size_t p = 2;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+void initialiserAttente(Attente *A){
+    atomic_init(&A->evenements, 0);
+    atomic_init(&A->dormeurs, 0);
+    atomic_init(&A->spin, 64);
+}
+
+/*
+ * @brief Crée une file bloquante vide
+ * @param capacite Capacité (arrondie à une puissance de deux)
+ * @return FileBloquante* La nouvelle file
+ * Complexité : O(capacite)
+ */
+FileBloquante *creerFileBloquante(size_t capacite){
+    FileBloquante *F = NULL;
+    capacite = puissanceDeDeux(capacite);
+    if (posix_memalign((void **)&F, LIGNE_CACHE, sizeof(FileBloquante)) != 0 ||
+        posix_memalign((void **)&F->cases, LIGNE_CACHE, capacite * sizeof(Case)) != 0){
+        perror("Erreur d'allocation pour creerFileBloquante");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < capacite; i++) atomic_init(&F->cases[i].sequence, i);
+    F->masque = capacite - 1;
+    atomic_init(&F->queue, 0);
+    atomic_init(&F->tete, 0);
+    initialiserAttente(&F->non_vide);
+    initialiserAttente(&F->non_pleine);
+    atomic_init(&F->appels_attente, 0);
+    atomic_init(&F->appels_reveil, 0);
+    return F;
+}
+
+void detruireFileBloquante(FileBloquante *F){
+    free(F->cases);
+    free(F);
+}
+
+#define UN_REVEIL ((uint_least64_t)1 << 32)
+#define ENDORMIS(d) ((d) & 0xffffffffu)
+#define REVEILS(d) ((d) >> 32)
+
+/*
+ * @brief Réveille un thread endormi sur A, sauf si tous les endormis ont déjà
+ *        un réveil en route (évite une rafale d'appels système pendant que le
+ *        thread réveillé n'a pas encore repris la main)
+ * Complexité : O(1), un appel système seulement si un thread dort sans réveil en route
+ */
+void reveiller(FileBloquante *F, Attente *A){
+    uint_least64_t d = atomic_load(&A->dormeurs);
+    do {
+        if (REVEILS(d) >= ENDORMIS(d)) return;
+    } while (!atomic_compare_exchange_weak(&A->dormeurs, &d, d + UN_REVEIL));
+    atomic_fetch_add(&A->evenements, 1);
+    futex(&A->evenements, FUTEX_WAKE_PRIVATE, 1, NULL);
+    atomic_fetch_add_explicit(&F->appels_reveil, 1, memory_order_relaxed);
+}
+
+/*
+ * @brief Tente d'ajouter un élément sans attendre (chemin rapide, sans verrou)
+ * @param x Valeur à insérer
+ * @param F La file
+ * @return false si la file est pleine
+ * Complexité : O(1) hors contention
+ */
+bool essayerEntree(int x, FileBloquante *F){
+    size_t rang = atomic_load_explicit(&F->queue, memory_order_relaxed);
+    for (;;){
+        Case *c = &F->cases[rang & F->masque];
+        size_t seq = atomic_load_explicit(&c->sequence, memory_order_acquire);
+        intptr_t ecart = (intptr_t)seq - (intptr_t)rang;
+        if (ecart == 0){
+            if (atomic_compare_exchange_weak_explicit(&F->queue, &rang, rang + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)){
+                c->valeur = x;
+                atomic_store_explicit(&c->sequence, rang + 1, memory_order_release);
+                atomic_thread_fence(memory_order_seq_cst);
+                size_t tete = atomic_load(&F->tete);
+                if (tete >= rang) reveiller(F, &F->non_vide);                   // la file était vide : transition
+                if (rang < tete + F->masque) reveiller(F, &F->non_pleine);       // relais : il reste de la place
+                return true;
+            }
+        } else if (ecart < 0){
+            return false;
+        } else {
+            rang = atomic_load_explicit(&F->queue, memory_order_relaxed);
+        }
+    }
+}
+
+/*
+ * @brief Tente de retirer l'élément de tête sans attendre
+ * @param x Pointeur pour stocker la valeur retirée
+ * @param F La file
+ * @return false si la file est vide
+ * Complexité : O(1) hors contention
+ */
+bool essayerSortie(int *x, FileBloquante *F){
+    size_t rang = atomic_load_explicit(&F->tete, memory_order_relaxed);
+    for (;;){
+        Case *c = &F->cases[rang & F->masque];
+        size_t seq = atomic_load_explicit(&c->sequence, memory_order_acquire);
+        intptr_t ecart = (intptr_t)seq - (intptr_t)(rang + 1);
+        if (ecart == 0){
+            if (atomic_compare_exchange_weak_explicit(&F->tete, &rang, rang + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)){
+                *x = c->valeur;
+                atomic_store_explicit(&c->sequence, rang + F->masque + 1, memory_order_release);
+                atomic_thread_fence(memory_order_seq_cst);
+                size_t queue = atomic_load(&F->queue);
+                if (queue - rang > F->masque) reveiller(F, &F->non_pleine);     // la file était pleine : transition
+                if (queue > rang + 1) reveiller(F, &F->non_vide);               // relais : il reste des éléments
+                return true;
+            }
+        } else if (ecart < 0){
+            return false;
+        } else {
+            rang = atomic_load_explicit(&F->tete, memory_order_relaxed);
+        }
+    }
+}
+
+// Un thread cesse d'attendre : il consomme au passage un réveil en route, s'il y en a
+void quitterAttente(Attente *A){
+    uint_least64_t d = atomic_load(&A->dormeurs);
+    uint_least64_t nouveau;
+    do {
+        nouveau = d - 1;
+        if (REVEILS(d) > 0) nouveau -= UN_REVEIL;
+    } while (!atomic_compare_exchange_weak(&A->dormeurs, &d, nouveau));
+}
+
+// Temps restant avant l'échéance, false si elle est dépassée
+bool tempsRestant(const struct timespec *echeance, struct timespec *reste){
+    struct timespec maintenant;
+    clock_gettime(CLOCK_MONOTONIC, &maintenant);
+    reste->tv_sec = echeance->tv_sec - maintenant.tv_sec;
+    reste->tv_nsec = echeance->tv_nsec - maintenant.tv_nsec;
+    if (reste->tv_nsec < 0){
+        reste->tv_nsec += 1000000000L;
+        reste->tv_sec--;
+    }
+    return reste->tv_sec >= 0;
+}
+
+/*
+ * @brief Répète une opération jusqu'au succès ou à l'échéance : attente active
+ *        adaptative puis sommeil sur le futex du côté concerné
+ * @param entree true pour une entrée (attend de la place), false pour une sortie
+ * @param x Valeur à insérer ou pointeur de sortie
+ * @param F La file
+ * @param echeance Échéance absolue (CLOCK_MONOTONIC), NULL pour attendre indéfiniment
+ * @return false si l'échéance est dépassée
+ * Complexité : O(1) par tentative
+ */
+bool attendre(bool entree, int *x, FileBloquante *F, const struct timespec *echeance){
+    Attente *A = entree ? &F->non_pleine : &F->non_vide;
+#define ESSAYER() (entree ? essayerEntree(*x, F) : essayerSortie(x, F))
+    if (ESSAYER()) return true;
+
+    unsigned int spin = atomic_load_explicit(&A->spin, memory_order_relaxed);
+    for (unsigned int i = 0; i < spin; i++){
+        PAUSE();
+        if (ESSAYER()){
+            // L'attente active a suffi : on l'allonge pour la prochaine fois
+            if (spin < SPIN_MAX) atomic_store_explicit(&A->spin, spin * 2, memory_order_relaxed);
+            return true;
+        }
+    }
+    if (spin > SPIN_MIN) atomic_store_explicit(&A->spin, spin / 2, memory_order_relaxed);
+
+    for (;;){
+        unsigned int evenements = atomic_load(&A->evenements);
+        atomic_fetch_add(&A->dormeurs, 1);
+        bool reussi = ESSAYER();
+        struct timespec reste;
+        if (!reussi && (echeance == NULL || tempsRestant(echeance, &reste))){
+            atomic_fetch_add_explicit(&F->appels_attente, 1, memory_order_relaxed);
+            futex(&A->evenements, FUTEX_WAIT_PRIVATE, evenements, echeance ? &reste : NULL);
+        }
+        quitterAttente(A);
+        if (reussi || ESSAYER()) return true;
+        if (echeance != NULL && !tempsRestant(echeance, &reste)) return false;
+    }
+#undef ESSAYER
+}
+
+// Échéance absolue à delai_ms millisecondes d'ici
+struct timespec echeanceDans(long delai_ms){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    t.tv_sec += delai_ms / 1000;
+    t.tv_nsec += (delai_ms % 1000) * 1000000L;
+    if (t.tv_nsec >= 1000000000L){
+        t.tv_nsec -= 1000000000L;
+        t.tv_sec++;
+    }
+    return t;
+}
+
+/*
+ * @brief Ajoute un élément, en attendant qu'une place se libère
+ * @param x Valeur à insérer
+ * @param F La file
+ * Complexité : O(1) hors attente
+ */
+void entree(int x, FileBloquante *F){
+    attendre(true, &x, F, NULL);
+}
+
+/*
+ * @brief Retire l'élément de tête, en attendant qu'un élément arrive
+ * @param x Pointeur pour stocker la valeur retirée
+ * @param F La file
+ * Complexité : O(1) hors attente
+ */
+void sortie(int *x, FileBloquante *F){
+    attendre(false, x, F, NULL);
+}
+
+/*
+ * @brief Comme entree, mais abandonne après delai_ms millisecondes
+ * @return false si le délai a expiré sans place libre
+ */
+bool entreeAvecDelai(int x, FileBloquante *F, long delai_ms){
+    struct timespec echeance = echeanceDans(delai_ms);
+    return attendre(true, &x, F, &echeance);
+}
+
+/*
+ * @brief Comme sortie, mais abandonne après delai_ms millisecondes
+ * @return false si le délai a expiré sans élément
+ */
+bool sortieAvecDelai(int *x, FileBloquante *F, long delai_ms){
+    struct timespec echeance = echeanceDans(delai_ms);
+    return attendre(false, x, F, &echeance);
+}
+
+// -------------------- Banc d'essai --------------------
+#define FIN (-1)
+
+typedef struct {
+    FileBloquante *F;
+    long debut, fin;
+    long long somme;
+    double cpu;         // temps processeur du thread, en secondes
+} Travail;
+
+double tempsCPUThread(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+double maintenant(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void *producteur(void *arg){
+    Travail *T = (Travail *)arg;
+    for (long i = T->debut; i < T->fin; i++) entree((int)i, T->F);
+    return NULL;
+}
+
+void *consommateur(void *arg){
+    Travail *T = (Travail *)arg;
+    int x;
+    for (;;){
+        sortie(&x, T->F);
+        if (x == FIN) break;
+        T->somme += x;
+    }
+    return NULL;
+}
+
+// Consommateur sur une file qui reste vide : il doit dormir sans consommer de processeur
+void *consommateurInactif(void *arg){
+    Travail *T = (Travail *)arg;
+    int x;
+    double debut = tempsCPUThread();
+    T->somme = sortieAvecDelai(&x, T->F, T->fin);
+    T->cpu = tempsCPUThread() - debut;
+    return NULL;
+}
+
+void lancerThread(pthread_t *t, void *(*f)(void *), void *arg){
+    if (pthread_create(t, NULL, f, arg) != 0){
+        perror("Erreur de création de thread");
+        exit(EXIT_FAILURE);
+    }
+}
+
+void mesurer(int P, int C, long n, size_t capacite){
+    FileBloquante *F = creerFileBloquante(capacite);
+    pthread_t threads[P + C];
+    Travail travaux[P + C];
+    double t0 = maintenant();
+    for (int i = 0; i < P + C; i++){
+        travaux[i] = (Travail){F, 0, 0, 0, 0};
+        if (i < P){
+            travaux[i].debut = n * i / P;
+            travaux[i].fin = n * (i + 1) / P;
+        }
+        lancerThread(&threads[i], i < P ? producteur : consommateur, &travaux[i]);
+    }
+    for (int i = 0; i < P; i++) pthread_join(threads[i], NULL);
+    for (int i = 0; i < C; i++) entree(FIN, F);
+    long long somme = 0;
+    for (int i = P; i < P + C; i++){
+        pthread_join(threads[i], NULL);
+        somme += travaux[i].somme;
+    }
+    double duree = maintenant() - t0;
+    if (somme != (long long)n * (n - 1) / 2){
+        fprintf(stderr, "Erreur : somme consommée incorrecte (%lld)\n", somme);
+        exit(EXIT_FAILURE);
+    }
+    printf("  %dP/%dC capacité %5zu : %7.2f M éléments/s, %lu attentes et %lu réveils futex\n",
+           P, C, capacite, n / duree / 1e6, atomic_load(&F->appels_attente), atomic_load(&F->appels_reveil));
+    detruireFileBloquante(F);
+}
+
+// -------------------- Main pour tester --------------------
+int main(int argc, char *argv[]){
+    FileBloquante *F = creerFileBloquante(2);
+    int valeurSortie;
+
+    printf("Enqueue 10, 20 dans une file de capacité 2\n");
+    entree(10, F);
+    entree(20, F);
+    printf("Enqueue 30 avec un délai de 50 ms : %s\n", entreeAvecDelai(30, F, 50) ? "accepté" : "délai expiré (file pleine)");
+    sortie(&valeurSortie, F);
+    printf("Valeur sortie : %d\n", valeurSortie);
+    sortie(&valeurSortie, F);
+    printf("Valeur sortie : %d\n", valeurSortie);
+    printf("Sortie avec un délai de 50 ms : %s\n", sortieAvecDelai(&valeurSortie, F, 50) ? "élément reçu" : "délai expiré (file vide)");
+
+    // Un consommateur qui attend 300 ms sur une file vide ne doit presque pas utiliser de processeur
+    Travail inactif = {F, 0, 300, 0, 0};
+    pthread_t t;
+    lancerThread(&t, consommateurInactif, &inactif);
+    pthread_join(t, NULL);
+    printf("Consommateur inactif pendant 300 ms : %.3f ms de processeur\n", inactif.cpu * 1e3);
+    detruireFileBloquante(F);
+
+    long n = (argc > 1) ? atol(argv[1]) : 2000000;
+    printf("\n%ld éléments :\n", n);
+    mesurer(1, 1, n, 1024);
+    mesurer(2, 2, n, 1024);
+    mesurer(4, 4, n, 1024);
+    mesurer(4, 4, n, 16);
+    return 0;
+}
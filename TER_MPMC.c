@@ -0,0 +1,501 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/*
+ * Files FIFO concurrentes sans verrou
+ *
+ * La file de TER.c n'est pas utilisable depuis plusieurs threads, et l'entourer
+ * d'un mutex sérialise tous les accès. Ce fichier propose deux variantes bornées
+ * en tableau circulaire (capacité puissance de deux) :
+ * - FileMPMC : plusieurs producteurs et plusieurs consommateurs. Chaque case porte
+ *   un numéro de séquence qui indique si elle est libre pour l'entrée de rang i
+ *   ou pleine pour la sortie de rang i ; un thread réserve un rang par
+ *   compare-and-swap sur le compteur partagé puis publie la case.
+ * - FileSPSC : un seul producteur et un seul consommateur. Chaque compteur n'a
+ *   qu'un écrivain, il n'y a donc ni CAS ni boucle de reprise : toute opération
+ *   se termine en un nombre borné de pas (sans attente).
+ *
+ * Les fonctions essayer* ne bloquent jamais ; entree* / sortie* réessaient en
+ * cédant le processeur tant que la file est pleine ou vide.
+ * entreeSPSC_batch / sortieSPSC_batch déplacent une suite d'éléments avec une
+ * seule synchronisation par lot.
+ * Le main mesure débit et latence pour plusieurs nombres de producteurs et de
+ * consommateurs.
+ *
+ * Compilation : gcc -O2 -pthread TER_MPMC.c
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+#define LIGNE_CACHE 64
+
+// -------------------- Structures --------------------
+typedef struct {
+    atomic_size_t sequence;   // rang attendu par la prochaine opération sur cette case
+    int valeur;
+} Case;
+
+typedef struct {
+    Case *cases;
+    size_t masque;                                   // capacité - 1
+    alignas(LIGNE_CACHE) atomic_size_t queue;        // prochain rang d'entrée
+    alignas(LIGNE_CACHE) atomic_size_t tete;         // prochain rang de sortie
+} FileMPMC;
+
+typedef struct {
+    int *valeurs;
+    size_t masque;
+    alignas(LIGNE_CACHE) atomic_size_t queue;        // écrit par le producteur seul
+    size_t tete_vue;                                 // copie locale au producteur
+    alignas(LIGNE_CACHE) atomic_size_t tete;         // écrit par le consommateur seul
+    size_t queue_vue;                                // copie locale au consommateur
+} FileSPSC;
+
+// -------------------- Fonctions --------------------
+
+// Plus petite puissance de deux >= n (au moins 2)
+// Complexité : O(log n)
+size_t puissanceDeDeux(size_t n){
+    size_t p = 2;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+void *allouerAligne(size_t taille){
+    void *p = NULL;
+    if (posix_memalign(&p, LIGNE_CACHE, taille) != 0){
+        perror("Erreur d'allocation pour allouerAligne");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+/*
+ * @brief Crée une file MPMC vide
+ * @param capacite Capacité (arrondie à une puissance de deux)
+ * @return FileMPMC* La nouvelle file
+ * Complexité : O(capacite)
+ */
+FileMPMC *creerFileMPMC(size_t capacite){
+    FileMPMC *F = (FileMPMC *)allouerAligne(sizeof(FileMPMC));
+    capacite = puissanceDeDeux(capacite);
+    F->cases = (Case *)allouerAligne(capacite * sizeof(Case));
+    for (size_t i = 0; i < capacite; i++){
+        atomic_init(&F->cases[i].sequence, i);
+    }
+    F->masque = capacite - 1;
+    atomic_init(&F->queue, 0);
+    atomic_init(&F->tete, 0);
+    return F;
+}
+
+void detruireFileMPMC(FileMPMC *F){
+    free(F->cases);
+    free(F);
+}
+
+/*
+ * @brief Tente d'ajouter un élément à la fin de la file
+ * @param x Valeur à insérer
+ * @param F La file
+ * @return false si la file est pleine
+ * Complexité : O(1) hors contention (sans verrou)
+ */
+bool essayerEntreeMPMC(int x, FileMPMC *F){
+    size_t rang = atomic_load_explicit(&F->queue, memory_order_relaxed);
+    for (;;){
+        Case *c = &F->cases[rang & F->masque];
+        size_t seq = atomic_load_explicit(&c->sequence, memory_order_acquire);
+        intptr_t ecart = (intptr_t)seq - (intptr_t)rang;
+        if (ecart == 0){
+            // Case libre pour ce rang : on tente de le réserver
+            if (atomic_compare_exchange_weak_explicit(&F->queue, &rang, rang + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)){
+                c->valeur = x;
+                atomic_store_explicit(&c->sequence, rang + 1, memory_order_release);
+                return true;
+            }
+            // rang a été rechargé par l'échec du CAS
+        } else if (ecart < 0){
+            return false;  // la case contient encore l'élément d'un tour précédent
+        } else {
+            rang = atomic_load_explicit(&F->queue, memory_order_relaxed);
+        }
+    }
+}
+
+/*
+ * @brief Tente de retirer l'élément de tête
+ * @param x Pointeur pour stocker la valeur retirée
+ * @param F La file
+ * @return false si la file est vide
+ * Complexité : O(1) hors contention (sans verrou)
+ */
+bool essayerSortieMPMC(int *x, FileMPMC *F){
+    size_t rang = atomic_load_explicit(&F->tete, memory_order_relaxed);
+    for (;;){
+        Case *c = &F->cases[rang & F->masque];
+        size_t seq = atomic_load_explicit(&c->sequence, memory_order_acquire);
+        intptr_t ecart = (intptr_t)seq - (intptr_t)(rang + 1);
+        if (ecart == 0){
+            if (atomic_compare_exchange_weak_explicit(&F->tete, &rang, rang + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)){
+                *x = c->valeur;
+                // La case redevient libre pour l'entrée du tour suivant
+                atomic_store_explicit(&c->sequence, rang + F->masque + 1, memory_order_release);
+                return true;
+            }
+        } else if (ecart < 0){
+            return false;  // aucune entrée publiée pour ce rang
+        } else {
+            rang = atomic_load_explicit(&F->tete, memory_order_relaxed);
+        }
+    }
+}
+
+void entreeMPMC(int x, FileMPMC *F){
+    while (!essayerEntreeMPMC(x, F)) sched_yield();
+}
+
+void sortieMPMC(int *x, FileMPMC *F){
+    while (!essayerSortieMPMC(x, F)) sched_yield();
+}
+
+/*
+ * @brief Crée une file SPSC vide
+ * @param capacite Capacité (arrondie à une puissance de deux)
+ * @return FileSPSC* La nouvelle file
+ * Complexité : O(1)
+ */
+FileSPSC *creerFileSPSC(size_t capacite){
+    FileSPSC *F = (FileSPSC *)allouerAligne(sizeof(FileSPSC));
+    capacite = puissanceDeDeux(capacite);
+    F->valeurs = (int *)allouerAligne(capacite * sizeof(int));
+    F->masque = capacite - 1;
+    atomic_init(&F->queue, 0);
+    atomic_init(&F->tete, 0);
+    F->tete_vue = 0;
+    F->queue_vue = 0;
+    return F;
+}
+
+void detruireFileSPSC(FileSPSC *F){
+    free(F->valeurs);
+    free(F);
+}
+
+/*
+ * @brief Tente d'ajouter un élément (appelé par le seul producteur)
+ * @param x Valeur à insérer
+ * @param F La file
+ * @return false si la file est pleine
+ * Complexité : O(1), sans attente
+ */
+bool essayerEntreeSPSC(int x, FileSPSC *F){
+    size_t queue = atomic_load_explicit(&F->queue, memory_order_relaxed);
+    if (queue - F->tete_vue > F->masque){
+        // La copie locale de tete est périmée : on ne relit le compteur partagé qu'ici
+        F->tete_vue = atomic_load_explicit(&F->tete, memory_order_acquire);
+        if (queue - F->tete_vue > F->masque) return false;
+    }
+    F->valeurs[queue & F->masque] = x;
+    atomic_store_explicit(&F->queue, queue + 1, memory_order_release);
+    return true;
+}
+
+/*
+ * @brief Tente de retirer l'élément de tête (appelé par le seul consommateur)
+ * @param x Pointeur pour stocker la valeur retirée
+ * @param F La file
+ * @return false si la file est vide
+ * Complexité : O(1), sans attente
+ */
+bool essayerSortieSPSC(int *x, FileSPSC *F){
+    size_t tete = atomic_load_explicit(&F->tete, memory_order_relaxed);
+    if (tete == F->queue_vue){
+        F->queue_vue = atomic_load_explicit(&F->queue, memory_order_acquire);
+        if (tete == F->queue_vue) return false;
+    }
+    *x = F->valeurs[tete & F->masque];
+    atomic_store_explicit(&F->tete, tete + 1, memory_order_release);
+    return true;
+}
+
+void entreeSPSC(int x, FileSPSC *F){
+    while (!essayerEntreeSPSC(x, F)) sched_yield();
+}
+
+void sortieSPSC(int *x, FileSPSC *F){
+    while (!essayerSortieSPSC(x, F)) sched_yield();
+}
+
+/*
+ * @brief Ajoute jusqu'à n éléments (appelé par le seul producteur)
+ *        Les valeurs sont copiées en au plus deux memcpy et publiées par une
+ *        seule écriture atomique du compteur, quel que soit n.
+ * @param x Valeurs à insérer, dans l'ordre
+ * @param n Nombre de valeurs
+ * @param F La file
+ * @return size_t Nombre de valeurs ajoutées (limité par la place libre)
+ * Complexité : O(n), sans attente
+ */
+size_t entreeSPSC_batch(const int *x, size_t n, FileSPSC *F){
+    size_t capacite = F->masque + 1;
+    size_t queue = atomic_load_explicit(&F->queue, memory_order_relaxed);
+    if (capacite - (queue - F->tete_vue) < n){
+        F->tete_vue = atomic_load_explicit(&F->tete, memory_order_acquire);
+        size_t libre = capacite - (queue - F->tete_vue);
+        if (n > libre) n = libre;
+    }
+    size_t debut = queue & F->masque;
+    size_t premier_morceau = capacite - debut;
+    if (premier_morceau > n) premier_morceau = n;
+    memcpy(F->valeurs + debut, x, premier_morceau * sizeof(int));
+    memcpy(F->valeurs, x + premier_morceau, (n - premier_morceau) * sizeof(int));
+    atomic_store_explicit(&F->queue, queue + n, memory_order_release);
+    return n;
+}
+
+/*
+ * @brief Retire jusqu'à max éléments (appelé par le seul consommateur)
+ * @param x Tableau recevant les valeurs, dans l'ordre
+ * @param max Capacité du tableau
+ * @param F La file
+ * @return size_t Nombre de valeurs retirées (0 si la file est vide)
+ * Complexité : O(max), sans attente
+ */
+size_t sortieSPSC_batch(int *x, size_t max, FileSPSC *F){
+    size_t capacite = F->masque + 1;
+    size_t tete = atomic_load_explicit(&F->tete, memory_order_relaxed);
+    if (F->queue_vue - tete < max){
+        F->queue_vue = atomic_load_explicit(&F->queue, memory_order_acquire);
+    }
+    size_t n = F->queue_vue - tete;
+    if (n > max) n = max;
+    size_t debut = tete & F->masque;
+    size_t premier_morceau = capacite - debut;
+    if (premier_morceau > n) premier_morceau = n;
+    memcpy(x, F->valeurs + debut, premier_morceau * sizeof(int));
+    memcpy(x + premier_morceau, F->valeurs, (n - premier_morceau) * sizeof(int));
+    atomic_store_explicit(&F->tete, tete + n, memory_order_release);
+    return n;
+}
+
+// -------------------- Banc d'essai --------------------
+#define FIN (-1)  // marqueur de fin envoyé à chaque consommateur
+
+typedef struct {
+    FileMPMC *mpmc;      // NULL pour la variante SPSC
+    FileSPSC *spsc;
+    long debut, fin;     // valeurs produites : [debut, fin)
+    long long somme;     // somme des valeurs consommées
+} Travail;
+
+void *producteur(void *arg){
+    Travail *T = (Travail *)arg;
+    for (long i = T->debut; i < T->fin; i++){
+        if (T->mpmc) entreeMPMC((int)i, T->mpmc);
+        else entreeSPSC((int)i, T->spsc);
+    }
+    return NULL;
+}
+
+void *consommateur(void *arg){
+    Travail *T = (Travail *)arg;
+    int x;
+    for (;;){
+        if (T->mpmc) sortieMPMC(&x, T->mpmc);
+        else sortieSPSC(&x, T->spsc);
+        if (x == FIN) break;
+        T->somme += x;
+    }
+    return NULL;
+}
+
+double maintenant(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void lancerThread(pthread_t *t, void *(*f)(void *), void *arg){
+    if (pthread_create(t, NULL, f, arg) != 0){
+        perror("Erreur de création de thread");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*
+ * @brief Fait transiter n valeurs de P producteurs vers C consommateurs
+ * @param spsc true pour la file SPSC (P = C = 1)
+ * @return double Débit en millions d'éléments par seconde
+ * Complexité : O(n)
+ */
+double mesurerDebit(int P, int C, long n, bool spsc){
+    FileMPMC *M = spsc ? NULL : creerFileMPMC(1024);
+    FileSPSC *S = spsc ? creerFileSPSC(1024) : NULL;
+    pthread_t threads[P + C];
+    Travail travaux[P + C];
+
+    double t0 = maintenant();
+    for (int i = 0; i < P + C; i++){
+        travaux[i] = (Travail){M, S, 0, 0, 0};
+        if (i < P){
+            travaux[i].debut = n * i / P;
+            travaux[i].fin = n * (i + 1) / P;
+        }
+        lancerThread(&threads[i], i < P ? producteur : consommateur, &travaux[i]);
+    }
+    for (int i = 0; i < P; i++) pthread_join(threads[i], NULL);
+    for (int i = 0; i < C; i++){
+        if (M) entreeMPMC(FIN, M);
+        else entreeSPSC(FIN, S);
+    }
+    long long somme = 0;
+    for (int i = P; i < P + C; i++){
+        pthread_join(threads[i], NULL);
+        somme += travaux[i].somme;
+    }
+    double duree = maintenant() - t0;
+
+    if (somme != (long long)n * (n - 1) / 2){
+        fprintf(stderr, "Erreur : somme consommée incorrecte (%lld)\n", somme);
+        exit(EXIT_FAILURE);
+    }
+    if (M) detruireFileMPMC(M);
+    else detruireFileSPSC(S);
+    return n / duree / 1e6;
+}
+
+// Variante par lots : le producteur envoie des suites de LOT valeurs
+#define LOT 256
+
+void *producteurLots(void *arg){
+    Travail *T = (Travail *)arg;
+    int lot[LOT];
+    for (long i = T->debut; i < T->fin; ){
+        size_t k = (T->fin - i < LOT) ? (size_t)(T->fin - i) : LOT;
+        for (size_t j = 0; j < k; j++) lot[j] = (int)(i + (long)j);
+        size_t envoyes = 0;
+        while (envoyes < k){
+            size_t m = entreeSPSC_batch(lot + envoyes, k - envoyes, T->spsc);
+            if (m == 0) sched_yield();
+            envoyes += m;
+        }
+        i += (long)k;
+    }
+    return NULL;
+}
+
+void *consommateurLots(void *arg){
+    Travail *T = (Travail *)arg;
+    int lot[LOT];
+    for (long recus = 0; recus < T->fin; ){
+        size_t m = sortieSPSC_batch(lot, LOT, T->spsc);
+        if (m == 0) sched_yield();
+        for (size_t j = 0; j < m; j++) T->somme += lot[j];
+        recus += (long)m;
+    }
+    return NULL;
+}
+
+/*
+ * @brief Comme mesurerDebit pour la file SPSC, mais par lots de LOT valeurs
+ * @return double Débit en millions d'éléments par seconde
+ * Complexité : O(n)
+ */
+double mesurerDebitLots(long n){
+    FileSPSC *S = creerFileSPSC(1024);
+    Travail prod = {NULL, S, 0, n, 0}, cons = {NULL, S, 0, n, 0};
+    pthread_t tp, tc;
+    double t0 = maintenant();
+    lancerThread(&tp, producteurLots, &prod);
+    lancerThread(&tc, consommateurLots, &cons);
+    pthread_join(tp, NULL);
+    pthread_join(tc, NULL);
+    double duree = maintenant() - t0;
+    if (cons.somme != (long long)n * (n - 1) / 2){
+        fprintf(stderr, "Erreur : somme consommée incorrecte (%lld)\n", cons.somme);
+        exit(EXIT_FAILURE);
+    }
+    detruireFileSPSC(S);
+    return n / duree / 1e6;
+}
+
+// Latence : un thread renvoie chaque valeur reçue, l'autre mesure l'aller-retour
+typedef struct {
+    FileMPMC *aller, *retour;
+    long n;
+} PingPong;
+
+void *renvoyeur(void *arg){
+    PingPong *P = (PingPong *)arg;
+    int x;
+    for (long i = 0; i < P->n; i++){
+        sortieMPMC(&x, P->aller);
+        entreeMPMC(x, P->retour);
+    }
+    return NULL;
+}
+
+/*
+ * @brief Latence moyenne d'un transfert (demi aller-retour) à travers une file MPMC
+ * @return double Latence en microsecondes
+ * Complexité : O(n)
+ */
+double mesurerLatence(long n){
+    PingPong P = {creerFileMPMC(16), creerFileMPMC(16), n};
+    pthread_t t;
+    lancerThread(&t, renvoyeur, &P);
+    int x;
+    double t0 = maintenant();
+    for (long i = 0; i < n; i++){
+        entreeMPMC((int)i, P.aller);
+        sortieMPMC(&x, P.retour);
+    }
+    double duree = maintenant() - t0;
+    pthread_join(t, NULL);
+    detruireFileMPMC(P.aller);
+    detruireFileMPMC(P.retour);
+    return duree / n / 2 * 1e6;
+}
+
+// -------------------- Main pour tester --------------------
+int main(int argc, char *argv[]){
+    FileMPMC *F = creerFileMPMC(4);
+    int valeurSortie;
+
+    printf("Enqueue 10, 20, 30\n");
+    entreeMPMC(10, F);
+    entreeMPMC(20, F);
+    entreeMPMC(30, F);
+    sortieMPMC(&valeurSortie, F);
+    printf("Valeur sortie : %d\n", valeurSortie);
+    sortieMPMC(&valeurSortie, F);
+    printf("Valeur sortie : %d\n", valeurSortie);
+    printf("Enqueue 40, 50, 60 dans une file de capacité 4 : %d %d %d\n",
+           essayerEntreeMPMC(40, F), essayerEntreeMPMC(50, F), essayerEntreeMPMC(60, F));
+    printf("Enqueue 70 : %s\n", essayerEntreeMPMC(70, F) ? "accepté" : "refusé (file pleine)");
+    detruireFileMPMC(F);
+
+    long n = (argc > 1) ? atol(argv[1]) : 2000000;
+    printf("\nDébit pour %ld éléments (millions d'éléments par seconde) :\n", n);
+    printf("  SPSC       1P/1C : %8.2f\n", mesurerDebit(1, 1, n, true));
+    printf("  SPSC lots  1P/1C : %8.2f\n", mesurerDebitLots(n));
+    int configurations[][2] = {{1, 1}, {2, 2}, {4, 4}, {1, 4}, {4, 1}};
+    for (size_t i = 0; i < sizeof(configurations) / sizeof(configurations[0]); i++){
+        int P = configurations[i][0], C = configurations[i][1];
+        printf("  MPMC       %dP/%dC : %8.2f\n", P, C, mesurerDebit(P, C, n, false));
+    }
+    printf("Latence MPMC (demi aller-retour) : %.3f µs\n", mesurerLatence(n / 20 + 1));
+    return 0;
+}
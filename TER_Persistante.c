@@ -0,0 +1,508 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+/*
+ * File FIFO persistante en journal circulaire projeté en mémoire
+ *
+ * La file de TER.c disparaît avec le processus. Ici les valeurs sont écrites
+ * dans un fichier projeté en mémoire (mmap) :
+ * - le fichier commence par une page d'en-tête contenant deux copies de
+ *   l'en-tête (tete, queue, numéro de séquence, somme de contrôle) ; chaque
+ *   validation écrit la copie la plus ancienne, une validation interrompue
+ *   laisse donc toujours une copie intacte ;
+ * - viennent ensuite capacite enregistrements {valeur, contrôle}, le contrôle
+ *   dépendant de la valeur et du rang de l'enregistrement dans le journal ;
+ * - validerFile force d'abord les enregistrements écrits sur disque (msync),
+ *   puis l'en-tête qui les référence ;
+ * - à l'ouverture, la copie d'en-tête valide la plus récente est retenue, le
+ *   contrôle de chaque enregistrement validé est vérifié, puis les
+ *   enregistrements écrits après la dernière validation sont repris tant
+ *   que leur contrôle correspond à leur rang ; les cases libres restantes sont
+ *   ensuite invalidées pour qu'aucun ancien enregistrement ne soit repris plus tard.
+ * Une sortie non validée avant un arrêt brutal est rejouée (au moins une fois) :
+ * la case qu'elle libère n'est réutilisée qu'après une validation, sinon une
+ * nouvelle entrée écraserait un enregistrement que l'en-tête sur disque compte
+ * encore dans la file.
+ *
+ * Modes de durabilité :
+ * - DURABILITE_AUCUNE : le système écrit les pages quand il le souhaite ;
+ * - DURABILITE_LOT : validation à la fin de chaque entree_batch / sortie_batch
+ *   et à chaque entree / sortie isolée ;
+ * - DURABILITE_GROUPE : validation groupée, après `operations` opérations, ou
+ *   par la première opération qui survient `delai_operation_suivante_ms`
+ *   millisecondes ou plus après la précédente validation. Aucun minuteur ne
+ *   valide une file inactive : après une rafale, appeler validerFile (ou
+ *   fermerFilePersistante) pour la rendre durable sans attendre d'autre opération.
+ *
+ * Spécifique à POSIX (mmap, msync). La complexité temporelle de chaque
+ * fonction est indiquée.
+ */
+
+#define MAGIQUE "TERLOG1"
+#define TAILLE_PAGE_ENTETE 4096
+#define DECALAGE_COPIE 512    // les deux copies sont dans des secteurs différents
+
+// -------------------- Structures --------------------
+typedef enum { DURABILITE_AUCUNE, DURABILITE_LOT, DURABILITE_GROUPE } ModeDurabilite;
+
+typedef struct {
+    ModeDurabilite mode;
+    unsigned int operations;        // DURABILITE_GROUPE : opérations entre deux validations
+    unsigned int delai_operation_suivante_ms;   // DURABILITE_GROUPE : au-delà, l'opération suivante valide
+} Durabilite;
+
+typedef struct {
+    char magique[8];
+    uint64_t sequence;              // numéro de validation
+    uint64_t capacite;
+    uint64_t tete;                  // rang du prochain enregistrement à sortir
+    uint64_t queue;                 // rang du prochain enregistrement à écrire
+    uint32_t controle;              // sur tous les champs précédents
+} Entete;
+
+typedef struct {
+    int32_t valeur;
+    uint32_t controle;              // dépend de la valeur et du rang
+} Enregistrement;
+
+typedef struct {
+    int fd;
+    unsigned char *carte;           // fichier projeté
+    size_t taille_carte;
+    Enregistrement *journal;
+    uint64_t capacite;
+    uint64_t tete, queue;           // état courant
+    uint64_t tete_validee;          // tete au moment de la dernière validation
+    uint64_t queue_validee;         // queue au moment de la dernière validation
+    uint64_t sequence;
+    Durabilite durabilite;
+    unsigned int en_attente;        // opérations depuis la dernière validation
+    struct timespec derniere_validation;
+    uint64_t recuperes;             // enregistrements repris après la dernière validation à l'ouverture
+} FilePersistante;
+
+// -------------------- Contrôles --------------------
+
+// Mélange 64 bits (finaliseur de splitmix64)
+uint64_t melanger(uint64_t x){
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+uint32_t controleEnregistrement(int32_t valeur, uint64_t rang){
+    return (uint32_t)melanger(rang * 0x9e3779b97f4a7c15ULL ^ (uint32_t)valeur ^ 0x5445524c4f47ULL);
+}
+
+uint32_t controleEntete(const Entete *E){
+    const unsigned char *p = (const unsigned char *)E;
+    uint64_t h = 0xcbf29ce484222325ULL;     // FNV-1a
+    for (size_t i = 0; i < offsetof(Entete, controle); i++){
+        h ^= p[i];
+        h *= 0x100000001b3ULL;
+    }
+    return (uint32_t)(h ^ (h >> 32));
+}
+
+bool enteteValide(const Entete *E){
+    return memcmp(E->magique, MAGIQUE, sizeof(MAGIQUE)) == 0 && E->controle == controleEntete(E) &&
+           E->tete <= E->queue && E->queue - E->tete <= E->capacite;
+}
+
+// -------------------- Fonctions --------------------
+double millisecondesDepuis(const struct timespec *t){
+    struct timespec maintenant;
+    clock_gettime(CLOCK_MONOTONIC, &maintenant);
+    return (maintenant.tv_sec - t->tv_sec) * 1e3 + (maintenant.tv_nsec - t->tv_nsec) * 1e-6;
+}
+
+// msync sur une plage d'octets du fichier, étendue aux pages qui la contiennent
+void synchroniser(FilePersistante *F, size_t debut, size_t fin){
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    debut -= debut % page;
+    if (fin > debut && msync(F->carte + debut, fin - debut, MS_SYNC) != 0){
+        perror("Erreur de msync");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Position en octets de l'enregistrement de rang donné
+size_t positionEnregistrement(const FilePersistante *F, uint64_t rang){
+    return TAILLE_PAGE_ENTETE + (size_t)(rang % F->capacite) * sizeof(Enregistrement);
+}
+
+/*
+ * @brief Rend durable l'état courant : enregistrements écrits depuis la
+ *        dernière validation, puis en-tête (dans la copie la plus ancienne)
+ * @param F La file
+ * Complexité : O(enregistrements écrits depuis la dernière validation) + deux msync
+ */
+void validerFile(FilePersistante *F){
+    if (F->queue != F->queue_validee){
+        uint64_t premier = F->queue_validee, dernier = F->queue - 1;
+        if (premier % F->capacite <= dernier % F->capacite && F->queue - premier <= F->capacite){
+            synchroniser(F, positionEnregistrement(F, premier), positionEnregistrement(F, dernier) + sizeof(Enregistrement));
+        } else {
+            synchroniser(F, TAILLE_PAGE_ENTETE, F->taille_carte);  // la plage fait le tour du journal
+        }
+    }
+    F->sequence++;
+    Entete E;
+    memset(&E, 0, sizeof(E));
+    memcpy(E.magique, MAGIQUE, sizeof(MAGIQUE));
+    E.sequence = F->sequence;
+    E.capacite = F->capacite;
+    E.tete = F->tete;
+    E.queue = F->queue;
+    E.controle = controleEntete(&E);
+    memcpy(F->carte + (F->sequence % 2) * DECALAGE_COPIE, &E, sizeof(E));
+    synchroniser(F, 0, TAILLE_PAGE_ENTETE);
+    F->tete_validee = F->tete;
+    F->queue_validee = F->queue;
+    F->en_attente = 0;
+    clock_gettime(CLOCK_MONOTONIC, &F->derniere_validation);
+}
+
+// Valide si le mode de durabilité le demande après une opération ou un lot
+void appliquerDurabilite(FilePersistante *F, unsigned int operations){
+    F->en_attente += operations;
+    switch (F->durabilite.mode){
+        case DURABILITE_AUCUNE:
+            break;
+        case DURABILITE_LOT:
+            validerFile(F);
+            break;
+        case DURABILITE_GROUPE:
+            // Le délai n'est examiné qu'ici, lors d'une opération : pas de minuteur
+            if (F->en_attente >= F->durabilite.operations ||
+                millisecondesDepuis(&F->derniere_validation) >= F->durabilite.delai_operation_suivante_ms){
+                validerFile(F);
+            }
+            break;
+    }
+}
+
+/*
+ * @brief Ouvre (ou crée) une file persistante et reprend son état
+ * @param chemin Fichier de la file
+ * @param capacite Nombre d'enregistrements si le fichier est créé (ignoré sinon)
+ * @param durabilite Politique de validation
+ * @return FilePersistante* La file
+ * Complexité : O(capacite) (à la reprise, les cases libres sont invalidées)
+ */
+FilePersistante *ouvrirFilePersistante(const char *chemin, size_t capacite, Durabilite durabilite){
+    FilePersistante *F = (FilePersistante *)calloc(1, sizeof(FilePersistante));
+    if (F == NULL){
+        perror("Erreur d'allocation pour ouvrirFilePersistante");
+        exit(EXIT_FAILURE);
+    }
+    F->fd = open(chemin, O_RDWR | O_CREAT, 0644);
+    struct stat st;
+    if (F->fd < 0 || fstat(F->fd, &st) != 0){
+        perror("Erreur d'ouverture de la file persistante");
+        exit(EXIT_FAILURE);
+    }
+    bool nouveau = (st.st_size == 0);
+    if (nouveau){
+        if (capacite == 0 || ftruncate(F->fd, TAILLE_PAGE_ENTETE + capacite * sizeof(Enregistrement)) != 0){
+            perror("Erreur de création de la file persistante");
+            exit(EXIT_FAILURE);
+        }
+        st.st_size = TAILLE_PAGE_ENTETE + capacite * sizeof(Enregistrement);
+    }
+    F->taille_carte = (size_t)st.st_size;
+    F->carte = mmap(NULL, F->taille_carte, PROT_READ | PROT_WRITE, MAP_SHARED, F->fd, 0);
+    if (F->carte == MAP_FAILED){
+        perror("Erreur de mmap");
+        exit(EXIT_FAILURE);
+    }
+    F->journal = (Enregistrement *)(F->carte + TAILLE_PAGE_ENTETE);
+    F->durabilite = durabilite;
+
+    if (nouveau){
+        F->capacite = capacite;
+        validerFile(F);
+        validerFile(F);   // les deux copies d'en-tête sont initialisées
+        return F;
+    }
+
+    // Reprise : copie d'en-tête valide la plus récente
+    Entete copies[2];
+    memcpy(&copies[0], F->carte, sizeof(Entete));
+    memcpy(&copies[1], F->carte + DECALAGE_COPIE, sizeof(Entete));
+    const Entete *E = NULL;
+    for (int i = 0; i < 2; i++){
+        if (enteteValide(&copies[i]) && (E == NULL || copies[i].sequence > E->sequence)) E = &copies[i];
+    }
+    if (E == NULL || TAILLE_PAGE_ENTETE + E->capacite * sizeof(Enregistrement) != F->taille_carte){
+        fprintf(stderr, "Erreur : %s n'est pas une file persistante valide\n", chemin);
+        exit(EXIT_FAILURE);
+    }
+    F->capacite = E->capacite;
+    F->sequence = E->sequence;
+    F->tete = E->tete;
+    F->queue = E->queue;
+    // Enregistrements validés : ils doivent tous être intègres
+    for (uint64_t rang = F->tete; rang < F->queue; rang++){
+        const Enregistrement *R = &F->journal[rang % F->capacite];
+        if (R->controle != controleEnregistrement(R->valeur, rang)){
+            fprintf(stderr, "Erreur : %s, enregistrement validé de rang %llu corrompu\n",
+                    chemin, (unsigned long long)rang);
+            exit(EXIT_FAILURE);
+        }
+    }
+    // Enregistrements écrits après la dernière validation : repris tant qu'ils sont intègres
+    while (F->queue - F->tete < F->capacite){
+        const Enregistrement *R = &F->journal[F->queue % F->capacite];
+        if (R->controle != controleEnregistrement(R->valeur, F->queue)) break;
+        F->queue++;
+        F->recuperes++;
+    }
+    // Au-delà du premier enregistrement invalide (écriture déchirée), des cases
+    // libres peuvent encore contenir des enregistrements intègres d'avant
+    // l'arrêt. Une fois la case déchirée réécrite et validée, une reprise
+    // suivante les rejouerait : on les invalide toutes avant de continuer.
+    for (uint64_t rang = F->queue; rang < F->tete + F->capacite; rang++){
+        Enregistrement *R = &F->journal[rang % F->capacite];
+        R->valeur = 0;
+        R->controle = ~controleEnregistrement(0, rang);
+    }
+    synchroniser(F, TAILLE_PAGE_ENTETE, F->taille_carte);
+    F->queue_validee = E->queue;
+    validerFile(F);
+    return F;
+}
+
+/*
+ * @brief Valide puis ferme la file
+ * Complexité : O(enregistrements non validés)
+ */
+void fermerFilePersistante(FilePersistante *F){
+    validerFile(F);
+    munmap(F->carte, F->taille_carte);
+    close(F->fd);
+    free(F);
+}
+
+size_t tailleFile(const FilePersistante *F){
+    return (size_t)(F->queue - F->tete);
+}
+
+bool estVideFile(const FilePersistante *F){
+    return F->queue == F->tete;
+}
+
+/*
+ * @brief Place disponible pour de nouveaux enregistrements. Les cases libérées
+ *        par des sorties non validées sont encore dans la file pour l'en-tête
+ *        sur disque : si elles manquent pour écrire `voulu` enregistrements,
+ *        les sorties sont d'abord validées
+ * @param F La file
+ * @param voulu Nombre d'enregistrements à écrire
+ * @return size_t Nombre de cases réutilisables sans risque
+ * Complexité : O(1) hors validation
+ */
+size_t placeLibre(FilePersistante *F, size_t voulu){
+    if (F->capacite - (F->queue - F->tete_validee) < voulu && F->tete != F->tete_validee) validerFile(F);
+    return (size_t)(F->capacite - (F->queue - F->tete_validee));
+}
+
+// Écrit un enregistrement sans appliquer la politique de durabilité
+void ecrireEnregistrement(int x, FilePersistante *F){
+    Enregistrement *R = &F->journal[F->queue % F->capacite];
+    R->valeur = x;
+    R->controle = controleEnregistrement(x, F->queue);
+    F->queue++;
+}
+
+/*
+ * @brief Tente d'ajouter un élément à la fin de la file
+ * @param x Valeur à insérer
+ * @param F La file
+ * @return false si la file est pleine
+ * Complexité : O(1) hors validation
+ */
+bool essayerEntree(int x, FilePersistante *F){
+    if (placeLibre(F, 1) == 0) return false;
+    ecrireEnregistrement(x, F);
+    appliquerDurabilite(F, 1);
+    return true;
+}
+
+void entree(int x, FilePersistante *F){
+    if (!essayerEntree(x, F)){
+        perror("Erreur : tentative d'entree sur une file pleine.");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/*
+ * @brief Retire l'élément de la tête de la file
+ * @param x Pointeur pour stocker la valeur retirée
+ * @param F La file
+ * Complexité : O(1) hors validation
+ */
+void sortie(int *x, FilePersistante *F){
+    if (estVideFile(F)){
+        perror("Erreur : tentative de sortie sur une file vide.");
+        exit(EXIT_FAILURE);
+    }
+    *x = F->journal[F->tete % F->capacite].valeur;
+    F->tete++;
+    appliquerDurabilite(F, 1);
+}
+
+/*
+ * @brief Ajoute jusqu'à n éléments, avec une seule validation pour le lot
+ * @return size_t Nombre de valeurs ajoutées (limité par la place libre)
+ * Complexité : O(n) hors validation
+ */
+size_t entree_batch(const int *x, size_t n, FilePersistante *F){
+    size_t libre = placeLibre(F, n);
+    if (n > libre) n = libre;
+    for (size_t i = 0; i < n; i++) ecrireEnregistrement(x[i], F);
+    if (n > 0) appliquerDurabilite(F, (unsigned int)n);
+    return n;
+}
+
+/*
+ * @brief Retire jusqu'à max éléments, avec une seule validation pour le lot
+ * @return size_t Nombre de valeurs retirées
+ * Complexité : O(max) hors validation
+ */
+size_t sortie_batch(int *x, size_t max, FilePersistante *F){
+    size_t n = tailleFile(F);
+    if (n > max) n = max;
+    for (size_t i = 0; i < n; i++) x[i] = F->journal[(F->tete + i) % F->capacite].valeur;
+    F->tete += n;
+    if (n > 0) appliquerDurabilite(F, (unsigned int)n);
+    return n;
+}
+
+void afficherFile(const FilePersistante *F){
+    if (estVideFile(F)){
+        printf("File vide\n");
+        return;
+    }
+    for (uint64_t r = F->tete; r != F->queue; r++) printf("%d ", F->journal[r % F->capacite].valeur);
+    printf("\n");
+}
+
+// -------------------- Main pour tester --------------------
+double mesurer(const char *chemin, Durabilite d, long n){
+    unlink(chemin);
+    FilePersistante *F = ouvrirFilePersistante(chemin, 1 << 16, d);
+    int lot[64];
+    struct timespec t0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (long i = 0; i < n; i += 64){
+        for (int j = 0; j < 64; j++) lot[j] = (int)(i + j);
+        entree_batch(lot, 64, F);
+        sortie_batch(lot, 64, F);
+    }
+    double ms = millisecondesDepuis(&t0);
+    fermerFilePersistante(F);
+    unlink(chemin);
+    return n / ms / 1e3;
+}
+
+int main(int argc, char *argv[]){
+    const char *chemin = (argc > 1) ? argv[1] : "file_persistante.bin";
+    Durabilite lot = {DURABILITE_LOT, 0, 0};
+    unlink(chemin);
+
+    FilePersistante *F = ouvrirFilePersistante(chemin, 16, lot);
+    int valeurSortie;
+    printf("Enqueue 10, 20, 30\n");
+    entree(10, F);
+    entree(20, F);
+    entree(30, F);
+    sortie(&valeurSortie, F);
+    printf("Valeur sortie : %d\n", valeurSortie);
+    fermerFilePersistante(F);
+
+    F = ouvrirFilePersistante(chemin, 0, lot);
+    printf("Après réouverture : ");
+    afficherFile(F);
+    fermerFilePersistante(F);
+
+    // Arrêt brutal d'un processus fils : 5 valeurs validées, 3 écrites sans validation,
+    // puis un enregistrement à moitié écrit
+    pid_t fils = fork();
+    if (fils == 0){
+        FilePersistante *G = ouvrirFilePersistante(chemin, 0, (Durabilite){DURABILITE_AUCUNE, 0, 0});
+        for (int i = 1; i <= 5; i++) ecrireEnregistrement(100 + i, G);
+        validerFile(G);
+        for (int i = 6; i <= 8 && tailleFile(G) < G->capacite; i++) ecrireEnregistrement(100 + i, G);
+        if (tailleFile(G) < G->capacite) G->journal[G->queue % G->capacite].valeur = 999;  // contrôle absent
+        _exit(0);
+    }
+    waitpid(fils, NULL, 0);
+    F = ouvrirFilePersistante(chemin, 0, lot);
+    printf("Après l'arrêt brutal : %llu enregistrements non validés repris, file : ",
+           (unsigned long long)F->recuperes);
+    afficherFile(F);
+    fermerFilePersistante(F);
+
+    // Écriture déchirée au rang r alors que r + 1 et r + 2 sont intacts sur le disque :
+    // la reprise s'arrête à r, puis une nouvelle entrée réécrit r. Les anciens r + 1
+    // et r + 2 ne doivent pas réapparaître à la reprise suivante.
+    fils = fork();
+    if (fils == 0){
+        FilePersistante *G = ouvrirFilePersistante(chemin, 0, (Durabilite){DURABILITE_AUCUNE, 0, 0});
+        uint64_t r = G->queue;
+        for (int i = 1; i <= 3; i++) ecrireEnregistrement(200 + i, G);
+        G->journal[r % G->capacite].valeur = 999;  // contrôle absent
+        _exit(0);
+    }
+    waitpid(fils, NULL, 0);
+    F = ouvrirFilePersistante(chemin, 0, lot);
+    entree(300, F);
+    fermerFilePersistante(F);
+    F = ouvrirFilePersistante(chemin, 0, lot);
+    printf("Après une écriture déchirée puis une entrée (300) : %llu enregistrement(s) repris, file : ",
+           (unsigned long long)F->recuperes);
+    afficherFile(F);
+    fermerFilePersistante(F);
+    unlink(chemin);
+
+    // Validation groupée, file pleine 10 11 12 13 validée : une sortie non validée
+    // puis une entrée ne doivent ni perdre 10 ni faire passer 99 en tête. La case
+    // de 10 n'est réécrite qu'après validation de la sortie.
+    F = ouvrirFilePersistante(chemin, 4, lot);
+    for (int i = 10; i <= 13; i++) entree(i, F);
+    fermerFilePersistante(F);
+    fils = fork();
+    if (fils == 0){
+        FilePersistante *G = ouvrirFilePersistante(chemin, 0, (Durabilite){DURABILITE_GROUPE, 1000, 60000});
+        int v;
+        sortie(&v, G);
+        entree(99, G);
+        _exit(0);
+    }
+    waitpid(fils, NULL, 0);
+    F = ouvrirFilePersistante(chemin, 0, lot);
+    printf("Validation groupée, sortie puis entrée (99) sur une file pleine avant l'arrêt : file : ");
+    afficherFile(F);
+    fermerFilePersistante(F);
+    unlink(chemin);
+
+    long n = 1 << 18;
+    printf("\nDébit entrée + sortie par lots de 64 (millions d'éléments par seconde) :\n");
+    printf("  sans synchronisation             : %8.3f\n", mesurer(chemin, (Durabilite){DURABILITE_AUCUNE, 0, 0}, n));
+    printf("  validation groupée (4096, 10 ms) : %8.3f\n", mesurer(chemin, (Durabilite){DURABILITE_GROUPE, 4096, 10}, n));
+    printf("  validation par lot               : %8.3f\n", mesurer(chemin, lot, n / 16));
+    return 0;
+}
@@ -0,0 +1,394 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+/*
+ * File FIFO non bornée en segments
+ *
+ * La file de TER.c alloue un Bloc par valeur. Ici la file est une liste
+ * chaînée de segments, chacun contenant TAILLE_SEGMENT valeurs contiguës :
+ * - entree n'alloue qu'un segment toutes les TAILLE_SEGMENT valeurs et ne
+ *   refuse jamais d'élément ;
+ * - un segment vidé par sortie est placé dans un petit cache et réutilisé par
+ *   la prochaine entree au lieu d'être libéré ;
+ * - la taille du cache suit une politique de plus haut niveau (high-water) :
+ *   à chaque période, la cible est le nombre de segments qui ont manqué au pic
+ *   de la période précédente, bornée par [cache_min, cache_max]. Après une
+ *   rafale la cible redescend et les segments en trop sont libérés un par un,
+ *   au rythme des retraits, pour que la latence de sortie reste stable.
+ *
+ * Le main compare cette file à la file chaînée de TER.c sous une charge mixte
+ * soutenue avec rafales.
+ *
+ * La complexité temporelle de chaque fonction est indiquée.
+ */
+
+#ifndef TAILLE_SEGMENT
+#define TAILLE_SEGMENT 1024
+#endif
+
+// -------------------- Structures --------------------
+typedef struct Segment {
+    struct Segment *suivant;
+    size_t debut;                    // prochaine case à lire
+    size_t fin;                      // prochaine case à écrire
+    int valeurs[TAILLE_SEGMENT];
+} Segment;
+
+typedef struct {
+    size_t cache_min;                // segments toujours conservés
+    size_t cache_max;                // segments jamais dépassés dans le cache
+    size_t periode;                  // nombre de segments retirés entre deux révisions de la cible
+} PolitiqueMemoire;
+
+typedef struct {
+    Segment *tete;                   // segment de lecture
+    Segment *queue;                  // segment d'écriture
+    size_t taille;                   // nombre d'éléments
+    size_t en_service;               // segments de la liste
+    Segment *cache;                  // segments retirés, chaînés par suivant
+    size_t nb_cache;
+    size_t cible_cache;              // taille visée du cache
+    size_t pic;                      // maximum de en_service pendant la période
+    size_t retraits;                 // segments retirés depuis la dernière révision
+    PolitiqueMemoire politique;
+} FileSegments;
+
+// -------------------- Fonctions --------------------
+
+/*
+ * @brief Crée une file vide avec un segment
+ * @param politique Politique de conservation des segments retirés
+ * @return FileSegments* La nouvelle file
+ * Complexité : O(1)
+ */
+FileSegments *creerFileSegments(PolitiqueMemoire politique){
+    FileSegments *F = (FileSegments *)malloc(sizeof(FileSegments));
+    Segment *S = (Segment *)malloc(sizeof(Segment));
+    if (F == NULL || S == NULL){
+        perror("Erreur d'allocation pour creerFileSegments");
+        exit(EXIT_FAILURE);
+    }
+    if (politique.cache_max < politique.cache_min) politique.cache_max = politique.cache_min;
+    if (politique.periode == 0) politique.periode = 1;
+    S->suivant = NULL;
+    S->debut = S->fin = 0;
+    F->tete = F->queue = S;
+    F->taille = 0;
+    F->en_service = 1;
+    F->cache = NULL;
+    F->nb_cache = 0;
+    F->cible_cache = politique.cache_min;
+    F->pic = 1;
+    F->retraits = 0;
+    F->politique = politique;
+    return F;
+}
+
+void detruireFileSegments(FileSegments *F){
+    for (Segment *S = F->tete; S != NULL; ){
+        Segment *suivant = S->suivant;
+        free(S);
+        S = suivant;
+    }
+    for (Segment *S = F->cache; S != NULL; ){
+        Segment *suivant = S->suivant;
+        free(S);
+        S = suivant;
+    }
+    free(F);
+}
+
+size_t tailleFile(const FileSegments *F){
+    return F->taille;
+}
+
+bool estVideFile(const FileSegments *F){
+    return F->taille == 0;
+}
+
+// Segments alloués (en service + cache)
+size_t segmentsAlloues(const FileSegments *F){
+    return F->en_service + F->nb_cache;
+}
+
+/*
+ * @brief Fournit un segment vide, pris dans le cache si possible
+ * @param F La file
+ * @return Segment* Le segment
+ * Complexité : O(1)
+ */
+Segment *obtenirSegment(FileSegments *F){
+    Segment *S = F->cache;
+    if (S != NULL){
+        F->cache = S->suivant;
+        F->nb_cache--;
+    } else {
+        S = (Segment *)malloc(sizeof(Segment));
+        if (S == NULL){
+            perror("Erreur d'allocation pour obtenirSegment");
+            exit(EXIT_FAILURE);
+        }
+    }
+    S->suivant = NULL;
+    S->debut = S->fin = 0;
+    return S;
+}
+
+/*
+ * @brief Rend un segment vidé : il va dans le cache tant que celui-ci est sous
+ *        sa cible, sinon il est libéré. La cible est révisée à chaque période.
+ * @param F La file
+ * @param S Le segment retiré
+ * Complexité : O(1)
+ */
+void rendreSegment(FileSegments *F, Segment *S){
+    if (++F->retraits >= F->politique.periode){
+        // Segments qui ont dû être pris en plus de ceux en service au pic de la période
+        size_t cible = F->pic - F->en_service;
+        if (cible < F->politique.cache_min) cible = F->politique.cache_min;
+        if (cible > F->politique.cache_max) cible = F->politique.cache_max;
+        F->cible_cache = cible;
+        F->pic = F->en_service;
+        F->retraits = 0;
+    }
+    if (F->nb_cache < F->cible_cache){
+        S->suivant = F->cache;
+        F->cache = S;
+        F->nb_cache++;
+    } else {
+        free(S);
+    }
+    // Rétrécissement progressif : au plus un segment en trop libéré par retrait
+    if (F->nb_cache > F->cible_cache){
+        Segment *surplus = F->cache;
+        F->cache = surplus->suivant;
+        F->nb_cache--;
+        free(surplus);
+    }
+}
+
+/*
+ * @brief Ajoute un élément à la fin de la file (enqueue), sans jamais le refuser
+ * @param x Valeur à insérer
+ * @param F La file
+ * Complexité : O(1)
+ */
+void entree(int x, FileSegments *F){
+    Segment *Q = F->queue;
+    if (Q->fin == TAILLE_SEGMENT){
+        Q->suivant = obtenirSegment(F);
+        Q = F->queue = Q->suivant;
+        if (++F->en_service > F->pic) F->pic = F->en_service;
+    }
+    Q->valeurs[Q->fin++] = x;
+    F->taille++;
+}
+
+/*
+ * @brief Retire l'élément de la tête de la file (dequeue)
+ * @param x Pointeur pour stocker la valeur retirée
+ * @param F La file
+ * Complexité : O(1)
+ */
+void sortie(int *x, FileSegments *F){
+    if (estVideFile(F)){
+        perror("Erreur : tentative de sortie sur une file vide.");
+        exit(EXIT_FAILURE);
+    }
+    Segment *T = F->tete;
+    *x = T->valeurs[T->debut++];
+    F->taille--;
+    if (T->debut == TAILLE_SEGMENT){
+        if (T->suivant != NULL){
+            F->tete = T->suivant;
+            F->en_service--;
+            rendreSegment(F, T);
+        } else {
+            // Dernier segment entièrement lu : on le réutilise sur place
+            T->debut = T->fin = 0;
+        }
+    }
+}
+
+/*
+ * @brief Rend immédiatement au système les segments du cache au-delà de cache_min
+ * @param F La file
+ * Complexité : O(nb_cache)
+ */
+void reduireFile(FileSegments *F){
+    F->cible_cache = F->politique.cache_min;
+    while (F->nb_cache > F->cible_cache){
+        Segment *S = F->cache;
+        F->cache = S->suivant;
+        F->nb_cache--;
+        free(S);
+    }
+    F->pic = F->en_service;
+}
+
+/*
+ * @brief Affiche tous les éléments de la file sans la modifier
+ * @param F La file
+ * Complexité : O(n)
+ */
+void afficherFile(const FileSegments *F){
+    if (estVideFile(F)){
+        printf("File vide\n");
+        return;
+    }
+    for (const Segment *S = F->tete; S != NULL; S = S->suivant){
+        for (size_t i = S->debut; i < S->fin; i++) printf("%d ", S->valeurs[i]);
+    }
+    printf("\n");
+}
+
+// -------------------- File chaînée de TER.c (référence) --------------------
+typedef struct Bloc {
+    int valeur;
+    struct Bloc *suivant;
+} Bloc;
+
+typedef Bloc *File;  // Pointeur vers le dernier élément de la file
+
+void entreeChainee(int x, File *F_ptr){
+    File F = *F_ptr;
+    Bloc *N = (Bloc *)malloc(sizeof(Bloc));
+    if (N == NULL){
+        perror("Erreur d'allocation pour entreeChainee");
+        exit(EXIT_FAILURE);
+    }
+    N->valeur = x;
+    if (F == NULL){
+        N->suivant = N;
+    } else {
+        N->suivant = F->suivant;
+        F->suivant = N;
+    }
+    *F_ptr = N;
+}
+
+void sortieChainee(int *x, File *F_ptr){
+    File F = *F_ptr;
+    Bloc *H = F->suivant;
+    *x = H->valeur;
+    if (F == H){
+        *F_ptr = NULL;
+    } else {
+        F->suivant = H->suivant;
+    }
+    free(H);
+}
+
+// -------------------- Banc d'essai --------------------
+long nanosecondes(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+int comparerLong(const void *a, const void *b){
+    long x = *(const long *)a, y = *(const long *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Charge mixte : à chaque tour, une rafale de 0 à 2 * moyenne entrées (une
+ * rafale de taille 100 * moyenne tous les 1000 tours), puis jusqu'à
+ * moyenne + moyenne / 8 sorties, un peu plus que le débit d'entrée moyen pour
+ * que la file se résorbe après chaque grosse rafale. La durée de chaque sortie
+ * est enregistrée.
+ */
+typedef struct {
+    long *durees;
+    size_t nb;
+    long long somme;
+    double secondes;
+} Mesure;
+
+Mesure chargeMixte(bool segments, int tours, int moyenne, unsigned graine){
+    FileSegments *F = segments ? creerFileSegments((PolitiqueMemoire){2, 64, 16}) : NULL;
+    File L = NULL;
+    size_t taille = 0;
+    Mesure M = {malloc((size_t)tours * 2 * moyenne * sizeof(long)), 0, 0, 0};
+    if (M.durees == NULL){
+        perror("Erreur d'allocation pour chargeMixte");
+        exit(EXIT_FAILURE);
+    }
+    srand(graine);
+    long debut = nanosecondes();
+    for (int t = 0; t < tours; t++){
+        int rafale = (t % 1000 == 999) ? 100 * moyenne : rand() % (2 * moyenne + 1);
+        for (int i = 0; i < rafale; i++){
+            if (segments) entree(t + i, F);
+            else entreeChainee(t + i, &L);
+        }
+        taille += (size_t)rafale;
+        for (int i = 0; i < moyenne + moyenne / 8 && taille > 0; i++, taille--){
+            int x;
+            long avant = nanosecondes();
+            if (segments) sortie(&x, F);
+            else sortieChainee(&x, &L);
+            long apres = nanosecondes();
+            M.durees[M.nb++] = apres - avant;
+            M.somme += x;
+        }
+    }
+    M.secondes = (nanosecondes() - debut) * 1e-9;
+    if (segments){
+        printf("  segments alloués en fin de charge : %zu (%zu en service, %zu en cache)\n",
+               segmentsAlloues(F), F->en_service, F->nb_cache);
+        detruireFileSegments(F);
+    } else {
+        int x;
+        while (L != NULL) sortieChainee(&x, &L);
+    }
+    return M;
+}
+
+void afficherMesure(const char *nom, Mesure *M){
+    qsort(M->durees, M->nb, sizeof(long), comparerLong);
+    printf("  %-14s %.3f s, sortie p50 %ld ns, p99 %ld ns, p99.9 %ld ns\n", nom, M->secondes,
+           M->durees[M->nb / 2], M->durees[M->nb * 99 / 100], M->durees[M->nb * 999 / 1000]);
+    free(M->durees);
+}
+
+// -------------------- Main pour tester --------------------
+int main(int argc, char *argv[]){
+    FileSegments *F = creerFileSegments((PolitiqueMemoire){1, 8, 4});
+    int valeurSortie;
+
+    printf("Enqueue 10, 20, 30\n");
+    entree(10, F);
+    entree(20, F);
+    entree(30, F);
+    printf("Etat de la file : ");
+    afficherFile(F);
+    sortie(&valeurSortie, F);
+    printf("Valeur sortie : %d\n", valeurSortie);
+    sortie(&valeurSortie, F);
+    sortie(&valeurSortie, F);
+
+    // Rafale puis accalmie : le cache se remplit puis redescend
+    for (int i = 0; i < 50 * TAILLE_SEGMENT; i++) entree(i, F);
+    printf("Après une rafale de %d valeurs : %zu segments alloués\n", 50 * TAILLE_SEGMENT, segmentsAlloues(F));
+    while (!estVideFile(F)) sortie(&valeurSortie, F);
+    printf("File vidée : %zu segments alloués (%zu en cache)\n", segmentsAlloues(F), F->nb_cache);
+    for (int tour = 0; tour < 64; tour++){
+        for (int i = 0; i < TAILLE_SEGMENT; i++) entree(i, F);
+        for (int i = 0; i < TAILLE_SEGMENT; i++) sortie(&valeurSortie, F);
+    }
+    printf("Après une charge calme : %zu segments alloués (%zu en cache)\n", segmentsAlloues(F), F->nb_cache);
+    detruireFileSegments(F);
+
+    int tours = (argc > 1) ? atoi(argv[1]) : 200000;
+    printf("\nCharge mixte, %d tours :\n", tours);
+    Mesure segments = chargeMixte(true, tours, 64, 42);
+    Mesure chainee = chargeMixte(false, tours, 64, 42);
+    afficherMesure("segments", &segments);
+    afficherMesure("file chaînée", &chainee);
+    printf("  résultats %s\n", segments.somme == chainee.somme ? "identiques" : "différents");
+    return 0;
+}